@@ -59,6 +59,7 @@
 #include <App/MaterialPy.h>
 #include <App/MetadataPy.h>
 // FreeCAD Base header
+#include <Base/ArrayViewPy.h>
 #include <Base/AxisPy.h>
 #include <Base/BaseClass.h>
 #include <Base/BoundBoxPy.h>
@@ -379,6 +380,10 @@ void Application::setupPythonTypes()
     Base::Vector2dPy::init_type();
     Base::Interpreter().addType(Base::Vector2dPy::type_object(),
         pBaseModule,"Vector2d");
+
+    Base::ArrayViewPy::init_type();
+    Base::Interpreter().addType(Base::ArrayViewPy::type_object(),
+        pBaseModule,"ArrayView");
     // clang-format on
 }
 
@@ -2210,6 +2215,7 @@ void Application::initTypes()
     new Base::ExceptionProducer<Base::NotImplementedError>;
     new Base::ExceptionProducer<Base::ZeroDivisionError>;
     new Base::ExceptionProducer<Base::ReferenceError>;
+    new Base::ExceptionProducer<Base::BufferError>;
     new Base::ExceptionProducer<Base::ExpressionError>;
     new Base::ExceptionProducer<Base::ParserError>;
     new Base::ExceptionProducer<Base::UnicodeError>;
@@ -2261,6 +2267,7 @@ void parseProgramOptions(int ac, char ** av, const string& exe, variables_map& v
     ("disable-addon", value< vector<string> >()->composing(),"Disable a given addon.")
     ("single-instance", "Allow to run a single instance of the application")
     ("safe-mode", "Force enable safe mode")
+    ("startup-profile", "Prints the time spent in the module initialization at startup")
     ("pass", value< vector<string> >()->multitoken(), "Ignores the following arguments and pass them through to be used by a script")
     ;
 
@@ -2459,6 +2466,10 @@ void processProgramOptions(const variables_map& vm, std::map<std::string,std::st
         mConfig["DisabledAddons"] = temp;
     }
 
+    if (vm.count("startup-profile")) {
+        mConfig["StartupProfile"] = "1";
+    }
+
     if (vm.count("input-file")) {
         vector<string> files(vm["input-file"].as< vector<string> >());
         int OpenFileCount=0;
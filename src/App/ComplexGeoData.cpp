@@ -28,6 +28,7 @@
 
 #ifndef _PreComp_
 #include <cstdlib>
+#include <iterator>
 #endif
 
 #include <boost/regex.hpp>
@@ -213,6 +214,7 @@ bool ComplexGeoData::checkElementMapVersion(const char* ver) const
 
 size_t ComplexGeoData::getElementMapSize(bool flush) const
 {
+    restorePendingElementMap();
     if (flush) {
         flushElementMap();
 #ifdef _FC_MEM_TRACE
@@ -234,6 +236,7 @@ MappedName ComplexGeoData::getMappedName(const IndexedName& element,
         return {};
     }
     flushElementMap();
+    restorePendingElementMap();
     if (!_elementMap) {
         if (allowUnmapped) {
             return MappedName(element);
@@ -254,6 +257,7 @@ IndexedName ComplexGeoData::getIndexedName(const MappedName& name, ElementIDRefs
     if (!name) {
         return IndexedName();
     }
+    restorePendingElementMap();
     if (!_elementMap) {
         std::string str;
         return {name.appendToBuffer(str), getElementTypes()};
@@ -294,6 +298,7 @@ std::vector<std::pair<MappedName, ElementIDRefs>>
 ComplexGeoData::getElementMappedNames(const IndexedName& element, bool needUnmapped) const
 {
     flushElementMap();
+    restorePendingElementMap();
     if (_elementMap) {
         auto res = _elementMap->findAll(element);
         if (!res.empty()) {
@@ -309,6 +314,7 @@ ComplexGeoData::getElementMappedNames(const IndexedName& element, bool needUnmap
 
 ElementMapPtr ComplexGeoData::resetElementMap(ElementMapPtr elementMap)
 {
+    _pendingElementMap.reset();
     _elementMap.swap(elementMap);
     // We expect that if the ComplexGeoData ( TopoShape ) has a hasher, then its elementMap will
     // have the same one.  Make sure that happens.
@@ -321,6 +327,7 @@ ElementMapPtr ComplexGeoData::resetElementMap(ElementMapPtr elementMap)
 std::vector<MappedElement> ComplexGeoData::getElementMap() const
 {
     flushElementMap();
+    restorePendingElementMap();
     if (!_elementMap) {
         return {};
     }
@@ -332,11 +339,13 @@ ElementMapPtr ComplexGeoData::elementMap(bool flush) const
     if (flush) {
         flushElementMap();
     }
+    restorePendingElementMap();
     return _elementMap;
 }
 
 ElementMapPtr ComplexGeoData::ensureElementMap(bool flush)
 {
+    restorePendingElementMap();
     if (!_elementMap) {
         resetElementMap(std::make_shared<Data::ElementMap>());
     }
@@ -346,8 +355,61 @@ ElementMapPtr ComplexGeoData::ensureElementMap(bool flush)
 void ComplexGeoData::flushElementMap() const
 {}
 
+struct ComplexGeoData::PendingElementMap
+{
+    std::string data;
+    App::StringHasherRef hasher;
+    /// The restored map, shared by all copies of the object
+    ElementMapPtr elementMap;
+    bool restored = false;
+    bool failed = false;
+};
+
+bool ComplexGeoData::isRestoreFailed() const
+{
+    // The pending map may have failed to restore in a copy sharing it
+    return _restoreFailed || (_pendingElementMap && _pendingElementMap->failed);
+}
+
+bool ComplexGeoData::sharePendingElementMap(const ComplexGeoData& other)
+{
+    if (!other._pendingElementMap) {
+        return false;
+    }
+    _elementMap.reset();
+    _pendingElementMap = other._pendingElementMap;
+    return true;
+}
+
+void ComplexGeoData::restorePendingElementMap() const
+{
+    if (!_pendingElementMap) {
+        return;
+    }
+    auto pending = std::move(_pendingElementMap);
+    _pendingElementMap.reset();
+    if (!pending->restored) {
+        pending->restored = true;
+        try {
+            bio::stream<bio::array_source> stream(pending->data.c_str(), pending->data.size());
+            pending->elementMap = ElementMap::restoreDetached(pending->hasher, stream);
+        }
+        catch (Base::Exception& e) {
+            e.ReportException();
+            pending->failed = true;
+        }
+        std::string().swap(pending->data);
+    }
+    if (pending->failed) {
+        _restoreFailed = true;
+    }
+    // Bypass any override, as this is not a change of the element map
+    const_cast<ComplexGeoData*>(this)->ComplexGeoData::resetElementMap(pending->elementMap);
+}
+
 void ComplexGeoData::setElementMap(const std::vector<MappedElement>& map)
 {
+    _pendingElementMap.reset();
     _elementMap = std::make_shared<Data::ElementMap>();  // Get rid of the old one, if any, but make
                                                          // sure the memory exists for the new data.
     for (auto& element : map) {
@@ -630,6 +692,7 @@ void ComplexGeoData::restoreStream(std::istream& stream, std::size_t count)
 void ComplexGeoData::SaveDocFile(Base::Writer& writer) const
 {
     flushElementMap();
+    restorePendingElementMap();
     if (_elementMap) {
         writer.Stream() << "BeginElementMap v1\n";
         _elementMap->save(writer.Stream());
@@ -648,8 +711,13 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
             FC_WARN("Unknown element map format");  // NOLINT
         }
         else {
-            resetElementMap(std::make_shared<ElementMap>());
-            _elementMap = _elementMap->restore(Hasher, reader);
+            // Most element maps are never queried in a session, so only keep
+            // the data here and restore the map on first access.
+            auto pending = std::make_shared<PendingElementMap>();
+            pending->hasher = Hasher;
+            pending->data.assign(std::istreambuf_iterator<char>(reader),
+                                 std::istreambuf_iterator<char>());
+            _pendingElementMap = std::move(pending);
             return;
         }
     }
@@ -659,6 +727,10 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
 
 unsigned int ComplexGeoData::getMemSize() const
 {
+    // Checked before flushing, as a derived flushElementMap() may restore the pending map
+    if (_pendingElementMap) {
+        return static_cast<unsigned int>(_pendingElementMap->data.size());
+    }
     flushElementMap();
     if (_elementMap) {
         static const int multiplier {10};
@@ -677,6 +749,7 @@ void ComplexGeoData::setMappedChildElements(
 {
     // DO NOT reset element map if there is one. Because we allow mixing child
     // mapping and normal mapping
+    restorePendingElementMap();
     if (!_elementMap) {
         resetElementMap(std::make_shared<Data::ElementMap>());
     }
@@ -685,6 +758,7 @@ void ComplexGeoData::setMappedChildElements(
 
 std::vector<Data::ElementMap::MappedChildElements> ComplexGeoData::getMappedChildElements() const
 {
+    restorePendingElementMap();
     if (!_elementMap) {
         return {};
     }
@@ -694,6 +768,7 @@ std::vector<Data::ElementMap::MappedChildElements> ComplexGeoData::getMappedChil
 void ComplexGeoData::beforeSave() const
 {
     flushElementMap();
+    restorePendingElementMap();
     if (this->_elementMap) {
         this->_elementMap->beforeSave(Hasher);
     }
@@ -702,6 +777,7 @@ void ComplexGeoData::beforeSave() const
 void ComplexGeoData::hashChildMaps()
 {
     flushElementMap();
+    restorePendingElementMap();
     if (_elementMap) {
         _elementMap->hashChildMaps(Tag);
     }
@@ -710,6 +786,7 @@ void ComplexGeoData::hashChildMaps()
 bool ComplexGeoData::hasChildElementMap() const
 {
     flushElementMap();
+    restorePendingElementMap();
     return _elementMap && _elementMap->hasChildElementMap();
 }
 
@@ -276,12 +276,13 @@ public:
                               const ElementIDRefs* sid = nullptr,
                               bool overwrite = false)
     {
+        restorePendingElementMap();
         return _elementMap->setElementName(element, name, masterTag, sid, overwrite);
     }
 
     bool hasElementMap()
     {
-        return _elementMap != nullptr;
+        return _elementMap != nullptr || _pendingElementMap != nullptr;
     }
 
     /** Get mapped element names
@@ -316,6 +317,7 @@ public:
                            MappedName* original = nullptr,
                            std::vector<MappedName>* history = nullptr) const
     {
+        restorePendingElementMap();
         if (_elementMap != nullptr) {
             return _elementMap->getElementHistory(name, Tag, original, history);
         }
@@ -369,6 +371,7 @@ public:
      */
     void traceElement(const MappedName& name, TraceCallback cb) const
     {
+        restorePendingElementMap();
         _elementMap->traceElement(name, Tag, cb);
     }
 
@@ -385,13 +388,15 @@ public:
     unsigned int getMemSize() const override;
     void setPersistenceFileName(const char* name) const;
     virtual void beforeSave() const;
-    bool isRestoreFailed() const
+    bool isRestoreFailed() const;
+    void resetRestoreFailure() const
     {
-        return _restoreFailed;
+        _restoreFailed = false;
     }
-    void resetRestoreFailure() const
+    /// Check if the element map read by RestoreDocFile() has not been restored yet
+    bool hasPendingElementMap() const
     {
-        _restoreFailed = true;
+        return _pendingElementMap != nullptr;
     }
     //@}
 
@@ -506,9 +511,21 @@ protected:
 protected:
     ElementMapPtr elementMap(bool flush = true) const;
     ElementMapPtr ensureElementMap(bool flush = true);
+    /** Share the element map of another object without restoring it
+     *
+     * @return Returns false if \c other has no element map waiting to be
+     * restored, in which case nothing is changed.
+     */
+    bool sharePendingElementMap(const ComplexGeoData& other);
 
 private:
+    /// Restore the element map read by RestoreDocFile(), if not done yet
+    void restorePendingElementMap() const;
+
     ElementMapPtr _elementMap;
+    /// Element map read by RestoreDocFile(), restored on first access to the element map
+    struct PendingElementMap;
+    mutable std::shared_ptr<PendingElementMap> _pendingElementMap;
 
 protected:
     mutable std::string _persistenceName;
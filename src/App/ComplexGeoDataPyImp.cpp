@@ -34,6 +34,7 @@
 #include <App/ComplexGeoDataPy.cpp>
 #include <App/StringHasherPy.h>
 #include <App/StringIDPy.h>
+#include <Base/ArrayViewPy.h>
 #include <Base/BoundBoxPy.h>
 #include <Base/MatrixPy.h>
 #include <Base/PlacementPy.h>
@@ -299,6 +300,8 @@ PyObject* ComplexGeoDataPy::transformGeometry(PyObject* args)
         return nullptr;
     }
 
+    Base::ArrayViewPy::checkNotExported(dynamic_cast<const void*>(getComplexGeoDataPtr()));
+
     try {
         Base::Matrix4D mat = static_cast<Base::MatrixPy*>(obj)->value();
         getComplexGeoDataPtr()->transformGeometry(mat);
@@ -2191,6 +2191,9 @@ bool Document::saveToFile(const char* filename) const
         if (hGrp->GetBool("SaveBinaryBrep", false)) {
             writer.setMode("BinaryBrep");
         }
+        if (hGrp->GetBool("SaveBinaryGeometry", false)) {
+            writer.setMode("BinaryGeometry");
+        }
 
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << endl
                         << "<!--" << endl
@@ -2732,6 +2735,229 @@ static void _buildDependencyList(const std::vector<App::DocumentObject*>& object
     }
 }
 
+void DocumentP::addRank(DocumentObject* obj)
+{
+    objectRanks[obj] = nextRank++;
+    // An object coming back through undo/redo may already be linked by others.
+    for (auto inObj : obj->getInList()) {
+        if (objectRanks.count(inObj) != 0) {
+            rankRebuild = true;
+            break;
+        }
+    }
+}
+
+void DocumentP::removeRank(const DocumentObject* obj)
+{
+    objectRanks.erase(obj);
+}
+
+// Pearce-Kelly dynamic topological sort. Only the objects ranked between the
+// two ends of the new link are visited, and only those are given new ranks.
+void DocumentP::rankLinkAdded(DocumentObject* dependent, DocumentObject* dependency)
+{
+    if (rankRebuild || rankCycle) {
+        return;
+    }
+    if (StatusBits.test(Document::Restoring) || undoing || rollback) {
+        rankRebuild = true;
+        return;
+    }
+    auto itDependent = objectRanks.find(dependent);
+    auto itDependency = objectRanks.find(dependency);
+    if (itDependent == objectRanks.end() || itDependency == objectRanks.end()) {
+        return;
+    }
+    long lowerBound = itDependent->second;
+    long upperBound = itDependency->second;
+    if (upperBound < lowerBound) {
+        return;
+    }
+    if (dependent == dependency) {
+        rankCycle = true;
+        return;
+    }
+
+    // objects that must move up, i.e. the dependent and its InList within the bounds
+    std::vector<DocumentObject*> forward;
+    std::unordered_set<DocumentObject*> visited {dependent};
+    std::vector<DocumentObject*> pending {dependent};
+    while (!pending.empty()) {
+        auto obj = pending.back();
+        pending.pop_back();
+        forward.push_back(obj);
+        for (auto inObj : obj->getInList()) {
+            if (inObj == dependency) {
+                rankCycle = true;
+                return;
+            }
+            auto it = objectRanks.find(inObj);
+            if (it != objectRanks.end() && it->second < upperBound && visited.insert(inObj).second) {
+                pending.push_back(inObj);
+            }
+        }
+    }
+
+    // objects that must move down, i.e. the dependency and its OutList within the bounds
+    std::vector<DocumentObject*> backward;
+    visited = {dependency};
+    pending = {dependency};
+    while (!pending.empty()) {
+        auto obj = pending.back();
+        pending.pop_back();
+        backward.push_back(obj);
+        for (auto outObj : obj->getOutList()) {
+            auto it = objectRanks.find(outObj);
+            if (it != objectRanks.end() && it->second > lowerBound
+                && visited.insert(outObj).second) {
+                pending.push_back(outObj);
+            }
+        }
+    }
+
+    auto byRank = [this](const DocumentObject* a, const DocumentObject* b) {
+        return objectRanks[a] < objectRanks[b];
+    };
+    std::sort(forward.begin(), forward.end(), byRank);
+    std::sort(backward.begin(), backward.end(), byRank);
+
+    std::vector<long> ranks;
+    ranks.reserve(forward.size() + backward.size());
+    for (auto obj : backward) {
+        ranks.push_back(objectRanks[obj]);
+    }
+    for (auto obj : forward) {
+        ranks.push_back(objectRanks[obj]);
+    }
+    std::sort(ranks.begin(), ranks.end());
+
+    auto rank = ranks.begin();
+    for (auto obj : backward) {
+        objectRanks[obj] = *rank++;
+    }
+    for (auto obj : forward) {
+        objectRanks[obj] = *rank++;
+    }
+}
+
+void DocumentP::rankLinkRemoved()
+{
+    // removing a link never invalidates the order, but it may have broken a cycle
+    if (rankCycle) {
+        rankRebuild = true;
+    }
+}
+
+bool DocumentP::ranksUsable()
+{
+    if (rankRebuild) {
+        rebuildRanks();
+    }
+    return !rankCycle;
+}
+
+void DocumentP::rebuildRanks()
+{
+    FC_TIME_INIT(t);
+
+    rankRebuild = false;
+    rankCycle = false;
+
+    std::unordered_map<const DocumentObject*, int> outCount;
+    for (auto obj : objectArray) {
+        outCount[obj];
+        for (auto inObj : obj->getInList()) {
+            if (objectRanks.count(inObj) != 0) {
+                ++outCount[inObj];
+            }
+        }
+    }
+
+    std::deque<DocumentObject*> ready;
+    for (auto obj : objectArray) {
+        if (outCount[obj] == 0) {
+            ready.push_back(obj);
+        }
+    }
+    nextRank = 0;
+    std::size_t ranked = 0;
+    while (!ready.empty()) {
+        auto obj = ready.front();
+        ready.pop_front();
+        objectRanks[obj] = nextRank++;
+        ++ranked;
+        for (auto inObj : obj->getInList()) {
+            auto it = outCount.find(inObj);
+            if (it != outCount.end() && objectRanks.count(inObj) != 0 && --it->second == 0) {
+                ready.push_back(inObj);
+            }
+        }
+    }
+    if (ranked != objectArray.size()) {
+        rankCycle = true;
+    }
+
+    FC_TIME_LOG(t, "rebuild object order");
+}
+
+// Sorts the given objects by rank. Returns false if the ranks cannot be used
+// for these objects, e.g. because some of them belong to other documents, or
+// they are linked in a way the ranks do not account for (hidden links).
+bool DocumentP::sortByRank(std::vector<DocumentObject*>& objs, int outListOption)
+{
+    if (!ranksUsable()) {
+        return false;
+    }
+    for (auto obj : objs) {
+        if (objectRanks.count(obj) == 0) {
+            return false;
+        }
+    }
+    std::sort(objs.begin(), objs.end(), [this](DocumentObject* a, DocumentObject* b) {
+        return objectRanks[a] < objectRanks[b];
+    });
+    for (auto obj : objs) {
+        long rank = objectRanks[obj];
+        for (auto outObj : obj->getOutList(outListOption)) {
+            if (!outObj || !outObj->isAttachedToDocument()) {
+                continue;
+            }
+            auto it = objectRanks.find(outObj);
+            if (it == objectRanks.end() || it->second >= rank) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Collects the objects a full recompute has to look at, i.e. those that are
+// touched or must execute, and everything in their recursive InList, sorted
+// by rank. Returns false if the document links to external objects, as those
+// may need a recompute as well.
+bool DocumentP::getRecomputeCandidates(std::vector<DocumentObject*>& objs)
+{
+    if (!ranksUsable()) {
+        return false;
+    }
+    std::set<DocumentObject*> candidates;
+    for (auto obj : objectArray) {
+        if (candidates.count(obj) != 0 || !(obj->isTouched() || obj->mustExecute())) {
+            continue;
+        }
+        candidates.insert(obj);
+        std::set<DocumentObject*> inSet;
+        obj->getInListEx(inSet, true);
+        for (auto inObj : inSet) {
+            if (objectRanks.count(inObj) != 0) {
+                candidates.insert(inObj);
+            }
+        }
+    }
+    objs.assign(candidates.begin(), candidates.end());
+    return sortByRank(objs, 0);
+}
+
 std::vector<App::DocumentObject*>
 Document::getDependencyList(const std::vector<App::DocumentObject*>& objectArray, int options)
 {
@@ -2741,6 +2967,17 @@ Document::getDependencyList(const std::vector<App::DocumentObject*>& objectArray
         return ret;
     }
 
+    if (std::all_of(objectArray.begin(), objectArray.end(), [this](DocumentObject* obj) {
+            return obj && obj->getDocument() == this;
+        })) {
+        _buildDependencyList(objectArray, options, &ret, nullptr, nullptr);
+        int op = (options & DepNoXLinked) ? DocumentObject::OutListNoXLinked : 0;
+        if (d->sortByRank(ret, op)) {
+            return ret;
+        }
+        ret.clear();
+    }
+
     DependencyList depList;
     std::map<DocumentObject*, Vertex> objectMap;
     std::map<Vertex, DocumentObject*> vertexMap;
@@ -3139,8 +3376,14 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
     }
     std::reverse(topoSortedObjects.begin(),topoSortedObjects.end());
 #else
-    auto topoSortedObjects =
-        getDependencyList(objs.empty() ? d->objectArray : objs, DepSort | options);
+    std::vector<App::DocumentObject*> topoSortedObjects;
+    // On request, a full recompute only visits the touched objects and their
+    // dependents. Objects that get touched by the recompute are then skipped.
+    if (!objs.empty() || !(options & DepTouchedOnly)
+        || !d->getRecomputeCandidates(topoSortedObjects)) {
+        topoSortedObjects =
+            getDependencyList(objs.empty() ? d->objectArray : objs, DepSort | options);
+    }
 #endif
     for (auto obj : topoSortedObjects) {
         obj->setStatus(ObjectStatus::PendingRecompute, true);
@@ -3593,6 +3836,7 @@ DocumentObject* Document::addObject(const char* sType,
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
+    d->addRank(pcObject);
 
     // If we are restoring, don't set the Label object now; it will be restored later. This is to
     // avoid potential duplicate label conflicts later.
@@ -3705,6 +3949,7 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
         pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
         // insert in the vector
         d->objectArray.push_back(pcObject);
+        d->addRank(pcObject);
 
         pcObject->Label.setValue(ObjectName);
 
@@ -3775,6 +4020,7 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
+    d->addRank(pcObject);
 
     pcObject->Label.setValue(ObjectName);
 
@@ -3804,6 +4050,7 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName)
     }
     d->objectIdMap[pcObject->_Id] = pcObject;
     d->objectArray.push_back(pcObject);
+    d->addRank(pcObject);
     // cache the pointer to the name string in the Object (for performance of
     // DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
@@ -3924,6 +4171,7 @@ void Document::removeObject(const char* sName)
          ++obj) {
         if (*obj == pos->second) {
             d->objectArray.erase(obj);
+            d->removeRank(pos->second);
             break;
         }
     }
@@ -4008,6 +4256,7 @@ void Document::_removeObject(DocumentObject* pcObject)
          ++it) {
         if (*it == pcObject) {
             d->objectArray.erase(it);
+            d->removeRank(pcObject);
             break;
         }
     }
@@ -4025,6 +4274,16 @@ void Document::breakDependency(DocumentObject* pcObject, bool clear)
     PropertyLinkBase::breakLinks(pcObject, d->objectArray, clear);
 }
 
+void Document::_addDependency(DocumentObject* dependent, DocumentObject* dependency)
+{
+    d->rankLinkAdded(dependent, dependency);
+}
+
+void Document::_removeDependency()
+{
+    d->rankLinkRemoved();
+}
+
 std::vector<DocumentObject*>
 Document::copyObject(const std::vector<DocumentObject*>& objs, bool recursive, bool returnAll)
 {
@@ -362,6 +362,9 @@ public:
      *
      * @param objs: specify a sub set of objects to recompute. If empty, then
      * all object in this document is checked for recompute
+     * @param options: DependencyOption flags. With DepTouchedOnly and no
+     * objects given, only the touched objects and their dependents are
+     * checked, so objects touched by the recompute itself are skipped.
      */
     int recompute(const std::vector<App::DocumentObject*>& objs = {},
                   bool force = false,
@@ -470,6 +473,8 @@ public:
         DepNoXLinked = 2,
         /// Raise exception on cycles
         DepNoCycle = 4,
+        /// Used by recompute(): only visit the touched objects and their dependents
+        DepTouchedOnly = 8,
     };
     /** Get a complete list of all objects the given objects depend on.
      *
@@ -587,6 +592,10 @@ protected:
     /// checks if a valid transaction is open
     void _checkTransaction(DocumentObject* pcDelObj, const Property* What, int line);
     void breakDependency(DocumentObject* pcObject, bool clear);
+    /// called by DocumentObject when a back link is added, to keep the object order up to date
+    void _addDependency(DocumentObject* dependent, DocumentObject* dependency);
+    /// called by DocumentObject when a back link is removed
+    void _removeDependency();
     std::vector<App::DocumentObject*> readObjects(Base::XMLReader& reader);
     void writeObjects(const std::vector<App::DocumentObject*>&, Base::Writer& writer) const;
     bool saveToFile(const char* filename) const;
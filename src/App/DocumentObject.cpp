@@ -1254,6 +1254,9 @@ void App::DocumentObject::_removeBackLink(DocumentObject* rmvObj)
     auto it = std::find(_inList.begin(), _inList.end(), rmvObj);
     if (it != _inList.end()) {
         _inList.erase(it);
+        if (_pDoc) {
+            _pDoc->_removeDependency();
+        }
     }
 #else
     (void)rmvObj;
@@ -1268,6 +1271,9 @@ void App::DocumentObject::_addBackLink(DocumentObject* newObj)
     // only once this removal would clear the object from the inlist, even though there may be other
     // link properties from this object that link to us.
     _inList.push_back(newObj);
+    if (_pDoc && newObj && newObj->getDocument() == _pDoc) {
+        _pDoc->_addDependency(newObj, this);
+    }
 #else
     (void)newObj;
 #endif  // USE_OLD_DAG
@@ -233,6 +233,22 @@ void ElementMap::save(std::ostream& stream) const
     }
 }
 
+ElementMapPtr ElementMap::restoreDetached(::App::StringHasherRef hasherRef, std::istream& stream)
+{
+    // The map IDs are only unique within the document being restored.
+    std::unordered_map<unsigned, ElementMapPtr> idToElementMap;
+    idToElementMap.swap(_idToElementMap);
+    try {
+        auto res = std::make_shared<ElementMap>()->restore(std::move(hasherRef), stream);
+        idToElementMap.swap(_idToElementMap);
+        return res;
+    }
+    catch (...) {
+        idToElementMap.swap(_idToElementMap);
+        throw;
+    }
+}
+
 ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream& stream)
 {
     const char* msg = "Invalid element map";
@@ -101,6 +101,13 @@ public:
      */
     ElementMapPtr restore(::App::StringHasherRef hasherRef, std::istream& stream);
 
+    /** Restore a map outside of document restore. Same as \c restore, except that
+     * child maps are not shared with maps restored by other calls.
+     * @param hasherRef: where all the StringIDs are stored
+     * @param stream: stream to deserialize
+     */
+    static ElementMapPtr restoreDetached(::App::StringHasherRef hasherRef, std::istream& stream);
+
 
     /** Add a sub-element name mapping.
      *
@@ -176,9 +176,13 @@ def InitApplications():
     if os.path.isdir(additional_packages_path):
         sys.path.append(additional_packages_path)
 
+    Profile = FreeCAD.__StartupProfile__
+    Cache = FreeCAD.__MetadataCache__
+
     def RunInitPy(Dir):
         InstallFile = os.path.join(Dir,"Init.py")
         if (os.path.exists(InstallFile)):
+            start = Profile.start()
             try:
                 with open(InstallFile, 'rt', encoding='utf-8') as f:
                     exec(compile(f.read(), InstallFile, 'exec'))
@@ -191,20 +195,22 @@ def InitApplications():
                 Err('Please look into the log file for further information\n')
             else:
                 Log('Init:      Initializing ' + Dir + '... done\n')
+            Profile.stop(InstallFile, start)
         else:
             Log('Init:      Initializing ' + Dir + '(Init.py not found)... ignore\n')
 
     def processMetadataFile(MetadataFile):
-        meta = FreeCAD.Metadata(MetadataFile)
-        if not meta.supportsCurrentFreeCAD():
-            Msg(f'NOTICE: {meta.Name} does not support this version of FreeCAD, so is being skipped\n')
+        start = Profile.start()
+        meta = Cache.get(MetadataFile)
+        Profile.stop(MetadataFile, start)
+        if not meta["Supported"]:
+            Msg(f'NOTICE: {meta["Name"]} does not support this version of FreeCAD, so is being skipped\n')
             return None
-        content = meta.Content
-        if "workbench" in content:
-            workbenches = content["workbench"]
+        if meta["Workbenches"]:
+            workbenches = meta["Workbenches"]
             for workbench in workbenches:
                 if not workbench.supportsCurrentFreeCAD():
-                    Msg(f'NOTICE: {meta.Name} content item {workbench.Name} does not support this version of FreeCAD, so is being skipped\n')
+                    Msg(f'NOTICE: {meta["Name"]} content item {workbench.Name} does not support this version of FreeCAD, so is being skipped\n')
                     return None
                 subdirectory = workbench.Name if not workbench.Subdirectory else workbench.Subdirectory
                 subdirectory = subdirectory.replace("/",os.path.sep)
@@ -272,16 +278,17 @@ def InitApplications():
                     # Make sure that package.xml (if present) does not exclude this version of FreeCAD
                     MetadataFile = os.path.join(FreeCAD.getUserAppDataDir(), "Mod", freecad_module_name[8:], "package.xml")
                     if os.path.exists(MetadataFile):
-                        meta = FreeCAD.Metadata(MetadataFile)
-                        if not meta.supportsCurrentFreeCAD():
+                        if not Cache.get(MetadataFile)["Supported"]:
                             Msg(f'NOTICE: Addon "{freecad_module_name}" does not support this version of FreeCAD, so is being skipped\n')
                             continue
 
+                    start = Profile.start()
                     freecad_module = importlib.import_module(freecad_module_name)
                     extension_modules += [freecad_module_name]
                     if any (module_name == 'init' for _, module_name, ispkg in pkgutil.iter_modules(freecad_module.__path__)):
                         importlib.import_module(freecad_module_name + '.init')
                         Log('Init: Initializing ' + freecad_module_name + '... done\n')
+                        Profile.stop(freecad_module_name, start)
                     else:
                         Log('Init: No init module found in ' + freecad_module_name + ', skipping\n')
                 except Exception as inst:
@@ -314,6 +321,9 @@ def InitApplications():
     if len(platform.mac_ver()[0]) > 0:
         sys.path.append(os.path.expanduser('~/Library/Application Support/FreeCAD/Mod'))
 
+    Cache.save()
+    Profile.report("App")
+
 # some often used shortcuts (for lazy people like me  ;-)
 App = FreeCAD
 Log = FreeCAD.Console.PrintLog
@@ -702,6 +712,119 @@ class FCADLogger(object):
 
 FreeCAD.Logger = FCADLogger
 
+class StartupProfile(object):
+    '''Collects the time spent in the startup phases.
+
+       Enabled by the --startup-profile command line switch. The timings are
+       printed by report(), which is called at the end of InitApplications().
+    '''
+
+    def __init__(self):
+        import time
+        self._clock = time.perf_counter
+        self.enabled = FreeCAD.ConfigGet("StartupProfile") == "1"
+        self.timings = []
+
+    def start(self):
+        return self._clock() if self.enabled else None
+
+    def stop(self, phase, start):
+        if start is not None:
+            self.timings.append((phase, self._clock() - start))
+
+    def report(self, title):
+        if not self.enabled or not self.timings:
+            return
+        total = sum(t for _, t in self.timings)
+        Msg(f'{title} startup profile ({total:.3f} s):\n')
+        for phase, t in sorted(self.timings, key=lambda x: x[1], reverse=True):
+            Msg(f'  {t:8.3f} s  {phase}\n')
+        self.timings = []
+
+class MetadataCache(object):
+    '''Keeps what startup needs from the package.xml files of the modules.
+
+       Parsing package.xml is costly compared to reading a small JSON file, so
+       the parsed result is stored in the user cache directory. An entry is
+       used only as long as the modification time and size of its package.xml
+       and the FreeCAD version it was made with match.
+    '''
+
+    FileName = "StartupMetadataCache.json"
+
+    class Item(object):
+        '''The subset of a FreeCAD.Metadata content item used at startup'''
+        def __init__(self, data):
+            self.Name = data["Name"]
+            self.Subdirectory = data["Subdirectory"]
+            self.Classname = data["Classname"]
+            self.Icon = data["Icon"]
+            self.Supported = data["Supported"]
+
+        def supportsCurrentFreeCAD(self):
+            return self.Supported
+
+    def __init__(self):
+        self._entries = {}
+        self._dirty = False
+        self._version = "-".join(FreeCAD.Version()[:4])
+        try:
+            import json
+            with open(self._fileName(), 'rt', encoding='utf-8') as f:
+                data = json.load(f)
+            if data.get("Version") == self._version:
+                self._entries = data.get("Entries", {})
+        except Exception:
+            pass
+
+    def _fileName(self):
+        return os.path.join(FreeCAD.getUserCachePath(), self.FileName)
+
+    def get(self, metadataFile):
+        '''Returns a dict with the keys Name, Supported and Workbenches.
+
+           Workbenches holds MetadataCache.Item objects. Raises the exception of
+           FreeCAD.Metadata if the file can not be parsed.
+        '''
+        st = os.stat(metadataFile)
+        stamp = [st.st_mtime_ns, st.st_size]
+        entry = self._entries.get(metadataFile)
+        if entry is None or entry["Stamp"] != stamp:
+            meta = FreeCAD.Metadata(metadataFile)
+            workbenches = []
+            for wb in meta.Content.get("workbench", []):
+                workbenches.append({"Name": wb.Name,
+                                    "Subdirectory": wb.Subdirectory,
+                                    "Classname": wb.Classname,
+                                    "Icon": wb.Icon,
+                                    "Supported": wb.supportsCurrentFreeCAD()})
+            entry = {"Stamp": stamp,
+                     "Name": meta.Name,
+                     "Supported": meta.supportsCurrentFreeCAD(),
+                     "Workbenches": workbenches}
+            self._entries[metadataFile] = entry
+            self._dirty = True
+        return {"Name": entry["Name"],
+                "Supported": entry["Supported"],
+                "Workbenches": [MetadataCache.Item(wb) for wb in entry["Workbenches"]]}
+
+    def save(self):
+        if not self._dirty:
+            return
+        try:
+            import json
+            fileName = self._fileName()
+            with open(fileName + ".tmp", 'wt', encoding='utf-8') as f:
+                json.dump({"Version": self._version, "Entries": self._entries}, f)
+            os.replace(fileName + ".tmp", fileName)
+            self._dirty = False
+        except Exception as e:
+            Log(f'Init: Failed to save {self.FileName}: {e}\n')
+
+# shared with FreeCADGuiInit.py
+FreeCAD.__StartupProfile__ = StartupProfile()
+FreeCAD.__MetadataCache__ = MetadataCache()
+
 # init every application by importing Init.py
 try:
     InitApplications()
@@ -92,6 +92,14 @@ struct DocumentP
     std::multimap<const App::DocumentObject*, std::unique_ptr<App::DocumentObjectExecReturn>>
         _RecomputeLog;
 
+    // Topological order of the objects, maintained as links are added so that recompute does
+    // not have to sort the whole dependency graph each time. An object ranks lower than every
+    // object in its InList.
+    std::unordered_map<const App::DocumentObject*, long> objectRanks;
+    long nextRank = 0;
+    bool rankRebuild = false;  ///< the ranks must be rebuilt before they can be used
+    bool rankCycle = false;    ///< the ranks are unusable because of a cyclic dependency
+
     StringHasherRef Hasher;
 
     DocumentP();
@@ -137,6 +145,10 @@ struct DocumentP
         }
         objectMap.clear();
         objectIdMap.clear();
+        objectRanks.clear();
+        nextRank = 0;
+        rankRebuild = false;
+        rankCycle = false;
     }
 
     const char* findRecomputeLog(const App::DocumentObject* obj)
@@ -157,6 +169,15 @@ struct DocumentP
     static std::vector<App::DocumentObject*>
     partialTopologicalSort(const std::vector<App::DocumentObject*>& objects);
     static void checkStringHasher(const Base::XMLReader& reader);
+
+    void addRank(App::DocumentObject* obj);
+    void removeRank(const App::DocumentObject* obj);
+    void rankLinkAdded(App::DocumentObject* dependent, App::DocumentObject* dependency);
+    void rankLinkRemoved();
+    bool ranksUsable();
+    void rebuildRanks();
+    bool sortByRank(std::vector<App::DocumentObject*>& objs, int outListOption);
+    bool getRecomputeCandidates(std::vector<App::DocumentObject*>& objs);
 };
 
 }  // namespace App
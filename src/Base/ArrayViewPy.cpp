@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <map>
+#include <mutex>
+#include <sstream>
+#endif
+
+#include "ArrayViewPy.h"
+#include "Exception.h"
+
+
+using namespace Base;
+
+namespace
+{
+// The number of exported buffers for each object. Modifying code may check it
+// without holding the GIL.
+std::mutex exportMutex;
+std::map<const void*, int> exportCounts;
+}  // namespace
+
+void ArrayViewPy::init_type()
+{
+    behaviors().name("ArrayView");
+    behaviors().doc("Array of numbers exported through the buffer protocol");
+    // you must have overwritten the virtual functions
+    behaviors().supportRepr();
+    behaviors().supportBufferType(Py::PythonType::support_buffer_getbuffer
+                                  | Py::PythonType::support_buffer_releasebuffer);
+}
+
+Py::PythonType& ArrayViewPy::behaviors()
+{
+    return Py::PythonExtension<ArrayViewPy>::behaviors();
+}
+
+PyTypeObject* ArrayViewPy::type_object()
+{
+    return Py::PythonExtension<ArrayViewPy>::type_object();
+}
+
+bool ArrayViewPy::check(PyObject* py)
+{
+    return Py::PythonExtension<ArrayViewPy>::check(py);
+}
+
+ArrayViewPy::ArrayViewPy(const Layout& layout,
+                         const Py::Object& owner,
+                         std::shared_ptr<const void> holder)
+    : layout(layout)
+    , owner(owner)
+    , holder(std::move(holder))
+    , shape {layout.rows, layout.columns}
+    , strides {layout.rowStride, layout.itemSize}
+{}
+
+ArrayViewPy::~ArrayViewPy() = default;
+
+Py::Object ArrayViewPy::repr()
+{
+    std::stringstream str;
+    str << "<ArrayView " << layout.format << "[" << layout.rows << "][" << layout.columns << "]>";
+    return Py::String(str.str());  // NOLINT
+}
+
+int ArrayViewPy::buffer_get(Py_buffer* view, int flags)
+{
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && layout.readOnly) {
+        PyErr_SetString(PyExc_BufferError, "Array view is read-only");
+        return -1;
+    }
+
+    bool contiguous = layout.rowStride == layout.columns * layout.itemSize;
+    if ((flags & PyBUF_STRIDES) != PyBUF_STRIDES && !contiguous) {
+        PyErr_SetString(PyExc_BufferError, "Array view is not contiguous");
+        return -1;
+    }
+
+    view->obj = selfPtr();
+    Py_INCREF(view->obj);
+    view->buf = layout.data;
+    view->len = layout.rows * layout.columns * layout.itemSize;
+    view->readonly = layout.readOnly ? 1 : 0;
+    view->itemsize = layout.itemSize;
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? const_cast<char*>(layout.format)  // NOLINT
+                                                          : nullptr;
+    if ((flags & PyBUF_ND) == PyBUF_ND) {
+        view->ndim = 2;
+        view->shape = shape;
+    }
+    else {
+        view->ndim = 1;
+        view->shape = nullptr;
+    }
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? strides : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+
+    if (layout.source) {
+        std::lock_guard<std::mutex> lock(exportMutex);
+        exportCounts[layout.source]++;
+    }
+    return 0;
+}
+
+int ArrayViewPy::buffer_release(Py_buffer* /*view*/)
+{
+    if (layout.source) {
+        std::lock_guard<std::mutex> lock(exportMutex);
+        auto it = exportCounts.find(layout.source);
+        if (it != exportCounts.end() && --it->second == 0) {
+            exportCounts.erase(it);
+        }
+    }
+    return 0;
+}
+
+PyObject* ArrayViewPy::create(const Layout& layout, PyObject* owner, std::shared_ptr<const void> holder)
+{
+    Py::Object ownerObject(owner ? owner : Py_None);
+    auto view = new ArrayViewPy(layout, ownerObject, std::move(holder));
+    PyObject* memory = PyMemoryView_FromObject(view);
+    Py_DECREF(view);
+    return memory;
+}
+
+bool ArrayViewPy::isExported(const void* source)
+{
+    std::lock_guard<std::mutex> lock(exportMutex);
+    return exportCounts.find(source) != exportCounts.end();
+}
+
+void ArrayViewPy::checkNotExported(const void* source)
+{
+    if (isExported(source)) {
+        throw BufferError("Cannot modify data while it is exported to a buffer");
+    }
+}
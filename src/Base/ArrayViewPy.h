@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef BASE_ARRAYVIEWPY_H
+#define BASE_ARRAYVIEWPY_H
+
+#include <memory>
+#include <CXX/Extensions.hxx>
+#include <FCGlobal.h>
+
+namespace Base
+{
+
+/**
+ * A two-dimensional array of numbers, e.g. the coordinates of the points of a
+ * mesh, exported to Python through the buffer protocol without copying it.
+ * The view keeps the Python object or the data that owns the memory alive.
+ *
+ * A view of the data of a C++ object is only valid as long as the object
+ * isn't modified, as it may reallocate its memory. Therefore the view counts
+ * the buffers it exports for the object, and code that modifies the object
+ * must check isExported() or checkNotExported() first.
+ */
+// NOLINTNEXTLINE
+class BaseExport ArrayViewPy: public Py::PythonExtension<ArrayViewPy>
+{
+public:
+    /// Describes the memory of the array
+    struct Layout
+    {
+        void* data = nullptr;
+        /// The struct module format of an item, e.g. "f" or "I"
+        const char* format = "B";
+        Py_ssize_t itemSize = 1;
+        Py_ssize_t rows = 0;
+        Py_ssize_t columns = 1;
+        /// The distance in bytes between the first items of two rows
+        Py_ssize_t rowStride = 1;
+        bool readOnly = true;
+        /// The most derived C++ object that owns the memory, or nullptr
+        const void* source = nullptr;
+    };
+
+    static void init_type();  // announce properties and methods
+    static Py::PythonType& behaviors();
+    static PyTypeObject* type_object();
+    static bool check(PyObject* py);
+
+    ArrayViewPy(const Layout& layout, const Py::Object& owner, std::shared_ptr<const void> holder);
+    ~ArrayViewPy() override;
+
+    Py::Object repr() override;
+    int buffer_get(Py_buffer* view, int flags) override;
+    int buffer_release(Py_buffer* view) override;
+
+    /** Returns a memoryview of the array
+     * @param layout describes the array
+     * @param owner the Python object whose memory is viewed, or nullptr
+     * @param holder the data whose memory is viewed, if not owned by a Python object
+     */
+    static PyObject*
+    create(const Layout& layout, PyObject* owner, std::shared_ptr<const void> holder = nullptr);
+
+    /// Returns true if the memory of the object is exported to a buffer
+    static bool isExported(const void* source);
+    /// Throws a BufferError if the memory of the object is exported to a buffer
+    static void checkNotExported(const void* source);
+
+private:
+    Layout layout;
+    Py::Object owner;
+    std::shared_ptr<const void> holder;
+    Py_ssize_t shape[2];    // NOLINT
+    Py_ssize_t strides[2];  // NOLINT
+};
+
+}  // namespace Base
+
+#endif  // BASE_ARRAYVIEWPY_H
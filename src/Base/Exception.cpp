@@ -716,6 +716,23 @@ PyObject* ReferenceError::getPyExceptionType() const
 
 // ---------------------------------------------------------
 
+BufferError::BufferError() = default;
+
+BufferError::BufferError(const char* sMessage)
+    : Exception(sMessage)
+{}
+
+BufferError::BufferError(const std::string& sMessage)
+    : Exception(sMessage)
+{}
+
+PyObject* BufferError::getPyExceptionType() const
+{
+    return PyExc_BufferError;
+}
+
+// ---------------------------------------------------------
+
 ExpressionError::ExpressionError() = default;
 
 ExpressionError::ExpressionError(const char* sMessage)
@@ -790,6 +790,26 @@ public:
     PyObject* getPyExceptionType() const override;
 };
 
+/**
+ * The BufferError can be used to indicate that data cannot be modified
+ * while its memory is exported to a Python buffer.
+ */
+class BaseExport BufferError: public Exception
+{
+public:
+    /// Construction
+    BufferError();
+    explicit BufferError(const char* sMessage);
+    explicit BufferError(const std::string& sMessage);
+    BufferError(const BufferError&) = default;
+    BufferError(BufferError&&) = default;
+    /// Destruction
+    ~BufferError() noexcept override = default;
+    BufferError& operator=(const BufferError&) = default;
+    BufferError& operator=(BufferError&&) = default;
+    PyObject* getPyExceptionType() const override;
+};
+
 /**
  * The ExpressionError can be used to indicate erroneous.input
  * to the expression engine.
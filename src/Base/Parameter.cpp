@@ -674,6 +674,73 @@ ParameterGrp::GetAttributeMap(ParamType Type, const char* sFilter) const
     return res;
 }
 
+bool ParameterGrp::_GetValue(ParamType Type, const char* Name, std::string& Value) const
+{
+    if (!_pGroupNode) {
+        return false;
+    }
+
+    auto readValue = [this, Type, Name]() {
+        std::optional<std::string> value;
+        DOMElement* pcElem = FindElement(_pGroupNode, TypeName(Type), Name);
+        if (!pcElem) {
+            return value;
+        }
+        if (Type == ParamType::FCText) {
+            DOMNode* pcElem2 = pcElem->getFirstChild();
+            value = pcElem2 ? StrXUTF8(pcElem2->getNodeValue()).str : std::string();
+        }
+        else {
+            value = StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str();
+        }
+        return value;
+    };
+
+    // without a name the first element of the type is returned, which is not worth caching
+    if (!Name) {
+        auto value = readValue();
+        if (value) {
+            Value = std::move(*value);
+        }
+        return value.has_value();
+    }
+
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    auto& cache = _ValueCache[static_cast<std::size_t>(Type)];
+    auto it = cache.find(Name);
+    if (it == cache.end()) {
+        it = cache.emplace(Name, readValue()).first;
+    }
+    if (!it->second) {
+        return false;
+    }
+    Value = *it->second;
+    return true;
+}
+
+void ParameterGrp::_SetCachedValue(ParamType Type, const char* Name, const char* Value) const
+{
+    if (!Name) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    auto& cache = _ValueCache[static_cast<std::size_t>(Type)];
+    if (Value) {
+        cache[Name] = std::string(Value);
+    }
+    else {
+        cache[Name].reset();
+    }
+}
+
+void ParameterGrp::_ClearCache() const
+{
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    for (auto& cache : _ValueCache) {
+        cache.clear();
+    }
+}
+
 void ParameterGrp::_Notify(ParamType Type, const char* Name, const char* Value)
 {
     if (_Manager) {
@@ -708,6 +775,7 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
         // set the value only if different
         if (strcmp(StrX(pcElem->getAttribute(attr.unicodeForm())).c_str(), Value) != 0) {
             pcElem->setAttribute(attr.unicodeForm(), XStr(Value).unicodeForm());
+            _SetCachedValue(T, Name, Value);
             // trigger observer
             _Notify(T, Name, Value);
         }
@@ -719,19 +787,11 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
 
 bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
 {
-    if (!_pGroupNode) {
-        return bPreset;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
-    // if not return preset
-    if (!pcElem) {
+    std::string value;
+    if (!_GetValue(ParamType::FCBool, Name, value)) {
         return bPreset;
     }
-
-    // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(), "1") == 0);
+    return value == "1";
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -795,18 +855,11 @@ std::vector<std::pair<std::string, bool>> ParameterGrp::GetBoolMap(const char* s
 
 long ParameterGrp::GetInt(const char* Name, long lPreset) const
 {
-    if (!_pGroupNode) {
-        return lPreset;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return preset
-    if (!pcElem) {
+    std::string value;
+    if (!_GetValue(ParamType::FCInt, Name, value)) {
         return lPreset;
     }
-    // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    return atol(value.c_str());
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -864,20 +917,12 @@ std::vector<std::pair<std::string, long>> ParameterGrp::GetIntMap(const char* sF
 
 unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset) const
 {
-    if (!_pGroupNode) {
+    std::string value;
+    if (!_GetValue(ParamType::FCUInt, Name, value)) {
         return lPreset;
     }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-
-    // if yes check the value and return
     const int base = 10;
-    return strtoul(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(), nullptr, base);
+    return strtoul(value.c_str(), nullptr, base);
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -942,18 +987,11 @@ ParameterGrp::GetUnsignedMap(const char* sFilter) const
 
 double ParameterGrp::GetFloat(const char* Name, double dPreset) const
 {
-    if (!_pGroupNode) {
-        return dPreset;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return preset
-    if (!pcElem) {
+    std::string value;
+    if (!_GetValue(ParamType::FCFloat, Name, value)) {
         return dPreset;
     }
-    // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    return atof(value.c_str());
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1039,12 +1077,14 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
             XERCES_CPP_NAMESPACE_QUALIFIER DOMDocument* pDocument = _pGroupNode->getOwnerDocument();
             DOMText* pText = pDocument->createTextNode(XUTF8Str(sValue).unicodeForm());
             pcElem->appendChild(pText);
+            _SetCachedValue(ParamType::FCText, Name, sValue);
             if (isNew || sValue[0] != 0) {
                 _Notify(ParamType::FCText, Name, sValue);
             }
         }
         else if (strcmp(StrXUTF8(pcElem2->getNodeValue()).c_str(), sValue) != 0) {
             pcElem2->setNodeValue(XUTF8Str(sValue).unicodeForm());
+            _SetCachedValue(ParamType::FCText, Name, sValue);
             _Notify(ParamType::FCText, Name, sValue);
         }
         // trigger observer
@@ -1054,25 +1094,11 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
 
 std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
 {
-    if (!_pGroupNode) {
+    std::string value;
+    if (!_GetValue(ParamType::FCText, Name, value)) {
         return pPreset ? pPreset : "";
     }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    // if not return preset
-    if (!pcElem) {
-        if (!pPreset) {
-            return {};
-        }
-        return {pPreset};
-    }
-    // if yes check the value and return
-    DOMNode* pcElem2 = pcElem->getFirstChild();
-    if (pcElem2) {
-        return {StrXUTF8(pcElem2->getNodeValue()).c_str()};
-    }
-    return {};
+    return value;
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char* sFilter) const
@@ -1154,6 +1180,7 @@ void ParameterGrp::RemoveASCII(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCachedValue(ParamType::FCText, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCText, Name, nullptr);
@@ -1175,6 +1202,7 @@ void ParameterGrp::RemoveBool(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCachedValue(ParamType::FCBool, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCBool, Name, nullptr);
@@ -1197,6 +1225,7 @@ void ParameterGrp::RemoveFloat(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCachedValue(ParamType::FCFloat, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCFloat, Name, nullptr);
@@ -1218,6 +1247,7 @@ void ParameterGrp::RemoveInt(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCachedValue(ParamType::FCInt, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCInt, Name, nullptr);
@@ -1239,6 +1269,7 @@ void ParameterGrp::RemoveUnsigned(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCachedValue(ParamType::FCUInt, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCUInt, Name, nullptr);
@@ -1356,6 +1387,7 @@ void ParameterGrp::Clear(bool notify)
         DOMNode* node = _pGroupNode->removeChild(child);
         node->release();
     }
+    _ClearCache();
 
     for (auto& v : params) {
         _Notify(v.first, v.second.c_str(), nullptr);
@@ -1527,6 +1559,7 @@ void ParameterGrp::NotifyAll()
 void ParameterGrp::_Reset()
 {
     _pGroupNode = nullptr;
+    _ClearCache();
     for (auto& v : _GroupMap) {
         v.second->_Reset();
     }
@@ -1856,6 +1889,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE_QUALIFIER InputSou
     }
 
     _pGroupNode = FindElement(rootElem, "FCParamGroup", "Root");
+    _ClearCache();
 
     if (!_pGroupNode) {
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -1981,6 +2015,7 @@ void ParameterManager::CreateDocument()
     _pGroupNode = _pDocument->createElement(XStr("FCParamGroup").unicodeForm());
     _pGroupNode->setAttribute(XStr("Name").unicodeForm(), XStr("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    _ClearCache();
 }
 
 void ParameterManager::CheckDocument() const
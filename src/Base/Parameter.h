@@ -49,7 +49,11 @@ using PyObject = struct _object;
 #include <sstream>
 #endif
 
+#include <array>
 #include <map>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 #include <boost_signals2.hpp>
 #include <xercesc/util/XercesDefs.hpp>
@@ -302,6 +306,15 @@ protected:
     void _SetAttribute(ParamType Type, const char* Name, const char* Value);
     void _Notify(ParamType Type, const char* Name, const char* Value);
 
+    /** Get the value of a parameter through the value cache
+     *  On a cache miss the value is read from the DOM and remembered. Returns
+     *  false if there is no parameter of this Type and Name.
+     */
+    bool _GetValue(ParamType Type, const char* Name, std::string& Value) const;
+    /// Update the value cache after a change of the DOM, a null Value means removed
+    void _SetCachedValue(ParamType Type, const char* Name, const char* Value) const;
+    void _ClearCache() const;
+
     XERCES_CPP_NAMESPACE_QUALIFIER DOMElement*
     FindNextElement(XERCES_CPP_NAMESPACE_QUALIFIER DOMNode* Prev, const char* Type) const;
 
@@ -351,6 +364,9 @@ protected:
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+    /// values already read from the DOM by type and name, no value means the parameter is absent
+    mutable std::array<std::unordered_map<std::string, std::optional<std::string>>, 7> _ValueCache;
+    mutable std::mutex _CacheMutex;
 };
 
 /** The parameter serializer class
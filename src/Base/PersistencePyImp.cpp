@@ -25,6 +25,7 @@
 
 #include <boost/iostreams/stream.hpp>
 
+#include "ArrayViewPy.h"
 #include "Persistence.h"
 #include "Writer.h"
 #include <Base/PyWrapParseTupleAndKeywords.h>
@@ -122,6 +123,8 @@ PyObject* PersistencePy::restoreContent(PyObject* args)
         return nullptr;
     }
 
+    ArrayViewPy::checkNotExported(dynamic_cast<const void*>(getPersistencePtr()));
+
     // check if it really is a buffer
     if (!PyObject_CheckBuffer(buffer)) {
         PyErr_SetString(PyExc_TypeError, "Must be a buffer object");
@@ -28,7 +28,10 @@
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #endif
 
+#include <cerrno>
+#include <cstdlib>
 #include <locale>
+#include <stdexcept>
 
 #include "Reader.h"
 #include "Base64.h"
@@ -55,6 +58,46 @@ XERCES_CPP_NAMESPACE_USE
 
 using namespace std;
 
+namespace
+{
+// Copy an XML string into out if it is plain ASCII, reusing the buffer of out so that no
+// allocation is needed once it has grown. Returns false if a non-ASCII character is found;
+// those strings need a real transcoder.
+bool assignAscii(std::string& out, const XMLCh* const str, XMLSize_t length)
+{
+    out.resize(length);
+    for (XMLSize_t i = 0; i < length; i++) {
+        if (str[i] >= 0x80) {
+            return false;
+        }
+        out[i] = static_cast<char>(str[i]);
+    }
+    return true;
+}
+
+bool assignAscii(std::string& out, const XMLCh* const str)
+{
+    return assignAscii(out, str, XMLString::stringLen(str));
+}
+
+// Convert an attribute value without building a std::string first. Throws the same
+// exceptions as std::stol and friends.
+template<typename T, typename Converter>
+T convertAttribute(const char* value, Converter convert, const char* function)
+{
+    char* end = nullptr;
+    errno = 0;
+    T result = convert(value, &end);
+    if (end == value) {
+        throw std::invalid_argument(function);
+    }
+    if (errno == ERANGE) {
+        throw std::out_of_range(function);
+    }
+    return result;
+}
+}  // namespace
+
 
 // ---------------------------------------------------------------------------
 //  Base::XMLReader: Constructors and Destructor
@@ -110,32 +153,56 @@ const char* Base::XMLReader::localName() const
 
 unsigned int Base::XMLReader::getAttributeCount() const
 {
-    return static_cast<unsigned int>(AttrMap.size());
+    return static_cast<unsigned int>(AttrCount);
 }
 
 long Base::XMLReader::getAttributeAsInteger(const char* AttrName, const char* defaultValue) const
 {
-    return stol(getAttribute(AttrName, defaultValue));
+    return convertAttribute<long>(
+        getAttribute(AttrName, defaultValue),
+        [](const char* str, char** end) {
+            return std::strtol(str, end, 10);
+        },
+        "stol");
 }
 
 unsigned long Base::XMLReader::getAttributeAsUnsigned(const char* AttrName,
                                                       const char* defaultValue) const
 {
-    return stoul(getAttribute(AttrName, defaultValue), nullptr);
+    return convertAttribute<unsigned long>(
+        getAttribute(AttrName, defaultValue),
+        [](const char* str, char** end) {
+            return std::strtoul(str, end, 10);
+        },
+        "stoul");
 }
 
 double Base::XMLReader::getAttributeAsFloat(const char* AttrName, const char* defaultValue) const
 {
-    return stod(getAttribute(AttrName, defaultValue), nullptr);
+    return convertAttribute<double>(
+        getAttribute(AttrName, defaultValue),
+        [](const char* str, char** end) {
+            return std::strtod(str, end);
+        },
+        "stod");
+}
+
+const Base::XMLReader::Attribute* Base::XMLReader::findAttribute(const char* AttrName) const
+{
+    // elements rarely have more than a handful of attributes, a linear search is the fastest
+    for (std::size_t i = 0; i < AttrCount; i++) {
+        if (Attributes[i].name == AttrName) {
+            return &Attributes[i];
+        }
+    }
+    return nullptr;
 }
 
 const char* Base::XMLReader::getAttribute(const char* AttrName,            // NOLINT
                                           const char* defaultValue) const  // NOLINT
 {
-    auto pos = AttrMap.find(AttrName);
-
-    if (pos != AttrMap.end()) {
-        return pos->second.c_str();
+    if (const Attribute* attr = findAttribute(AttrName)) {
+        return attr->value.c_str();
     }
     if (defaultValue) {
         return defaultValue;
@@ -148,7 +215,7 @@ const char* Base::XMLReader::getAttribute(const char* AttrName,            // NO
 
 bool Base::XMLReader::hasAttribute(const char* AttrName) const
 {
-    return AttrMap.find(AttrName) != AttrMap.end();
+    return findAttribute(AttrName) != nullptr;
 }
 
 bool Base::XMLReader::read()
@@ -524,12 +591,27 @@ void Base::XMLReader::startElement(const XMLCh* const /*uri*/,
                                    const XERCES_CPP_NAMESPACE_QUALIFIER Attributes& attrs)
 {
     Level++;  // new scope
-    LocalName = StrX(localname).c_str();
+    if (!assignAscii(LocalName, localname)) {
+        LocalName = StrX(localname).c_str();
+    }
 
-    // saving attributes of the current scope, delete all previously stored ones
-    AttrMap.clear();
-    for (unsigned int i = 0; i < attrs.getLength(); i++) {
-        AttrMap[StrX(attrs.getQName(i)).c_str()] = StrXUTF8(attrs.getValue(i)).c_str();
+    // saving attributes of the current scope, overwriting the previously stored ones. The
+    // strings are kept between elements so that their buffers can be reused.
+    AttrCount = 0;
+    for (XMLSize_t i = 0; i < attrs.getLength(); i++) {
+        const XMLCh* qname = attrs.getQName(i);
+        const XMLCh* value = attrs.getValue(i);
+        if (AttrCount == Attributes.size()) {
+            Attributes.emplace_back();
+        }
+        Attribute& attr = Attributes[AttrCount];
+        if (!assignAscii(attr.name, qname)) {
+            attr.name = StrX(qname).c_str();
+        }
+        if (!assignAscii(attr.value, value)) {
+            attr.value = StrXUTF8(value).c_str();
+        }
+        AttrCount++;
     }
 
     ReadType = StartElement;
@@ -540,7 +622,9 @@ void Base::XMLReader::endElement(const XMLCh* const /*uri*/,
                                  const XMLCh* const /*qname*/)
 {
     Level--;  // end of scope
-    LocalName = StrX(localname).c_str();
+    if (!assignAscii(LocalName, localname)) {
+        LocalName = StrX(localname).c_str();
+    }
 
     if (ReadType == StartElement) {
         ReadType = StartEndElement;
@@ -562,7 +646,9 @@ void Base::XMLReader::endCDATA()
 
 void Base::XMLReader::characters(const XMLCh* const chars, const XMLSize_t length)
 {
-    Characters = StrX(chars).c_str();
+    if (!assignAscii(Characters, chars, length)) {
+        Characters = StrX(chars).c_str();
+    }
     ReadType = Chars;
     CharacterCount += length;
 }
@@ -28,6 +28,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <xercesc/framework/XMLPScanToken.hpp>
 #include <xercesc/sax2/Attributes.hpp>
@@ -332,8 +333,16 @@ private:
     unsigned int CharacterCount {0};
     std::streamsize CharacterOffset {-1};
 
-    std::map<std::string, std::string> AttrMap;
-    using AttrMapType = std::map<std::string, std::string>;
+    struct Attribute
+    {
+        std::string name;
+        std::string value;
+    };
+    // attributes of the current element. The vector is not shrunk between elements so that
+    // the strings can reuse their buffers, only the first AttrCount entries are valid.
+    std::vector<Attribute> Attributes;
+    std::size_t AttrCount {0};
+    const Attribute* findAttribute(const char* AttrName) const;
 
     enum
     {
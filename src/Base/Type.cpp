@@ -53,6 +53,8 @@ struct Base::TypeData
     Type parent;
     Type type;
     Type::instantiationMethod instMethod;
+    /// keys of the type and its ancestors, ordered from the root type down to the type itself
+    std::vector<unsigned int> ancestors;
 };
 
 map<string, unsigned int> Type::typemap;
@@ -129,6 +131,11 @@ Type Type::createType(const Type& parent, const char* name, instantiationMethod
     Type newType;
     newType.index = static_cast<unsigned int>(Type::typedata.size());
     TypeData* typeData = new TypeData(name, newType, parent, method);
+    // parents are registered before their children, so the parent's chain is complete
+    if (!parent.isBad()) {
+        typeData->ancestors = Type::typedata[parent.index]->ancestors;
+    }
+    typeData->ancestors.push_back(newType.index);
     Type::typedata.push_back(typeData);
 
     // add to dictionary for fast lookup
@@ -144,6 +151,7 @@ void Type::init()
 
 
     Type::typedata.push_back(new TypeData("BadType"));
+    Type::typedata.back()->ancestors.push_back(0);
     Type::typemap["BadType"] = 0;
 }
 
@@ -190,16 +198,11 @@ Type Type::getParent() const
 
 bool Type::isDerivedFrom(const Type& type) const
 {
-
-    Type temp(*this);
-    do {
-        if (temp == type) {
-            return true;
-        }
-        temp = temp.getParent();
-    } while (temp != badType());
-
-    return false;
+    // A type at depth n in the hierarchy is derived from 'type' if its
+    // ancestor at the depth of 'type' is 'type' itself.
+    const auto& ancestors = typedata[index]->ancestors;
+    std::size_t depth = typedata[type.index]->ancestors.size() - 1;
+    return depth < ancestors.size() && ancestors[depth] == type.index;
 }
 
 int Type::getAllDerivedFrom(const Type& type, std::vector<Type>& List)
@@ -2920,6 +2920,7 @@ static void doSelect(void* ud, SoEventCallback * cb)
     if (doc) {
         cb->setHandled();
 
+        Gui::SelectionBatch batch;
         const SoEvent* ev = cb->getEvent();
         if (ev && !ev->wasCtrlDown()) {
             Gui::Selection().clearSelection(doc->getName());
@@ -134,9 +134,13 @@ def InitApplications():
     #print ModDirs
     Log('Init:   Searching modules...\n')
 
+    Profile = FreeCAD.__StartupProfile__
+    Cache = FreeCAD.__MetadataCache__
+
     def RunInitGuiPy(Dir) -> bool:
         InstallFile = os.path.join(Dir,"InitGui.py")
         if os.path.exists(InstallFile):
+            start = Profile.start()
             try:
                 with open(InstallFile, 'rt', encoding='utf-8') as f:
                     exec(compile(f.read(), InstallFile, 'exec'))
@@ -151,18 +155,19 @@ def InitApplications():
             else:
                 Log('Init:      Initializing ' + Dir + '... done\n')
                 return True
+            finally:
+                Profile.stop(InstallFile, start)
         else:
             Log('Init:      Initializing ' + Dir + '(InitGui.py not found)... ignore\n')
         return False
 
     def processMetadataFile(Dir, MetadataFile):
-        meta = FreeCAD.Metadata(MetadataFile)
-        if not meta.supportsCurrentFreeCAD():
+        meta = Cache.get(MetadataFile)
+        if not meta["Supported"]:
             return None
-        content = meta.Content
-        if "workbench" in content:
+        if meta["Workbenches"]:
             FreeCAD.Gui.addIconPath(Dir)
-            workbenches = content["workbench"]
+            workbenches = meta["Workbenches"]
             for workbench_metadata in workbenches:
                 if not workbench_metadata.supportsCurrentFreeCAD():
                     return None
@@ -242,18 +247,19 @@ def InitApplications():
             MetadataFile = os.path.join(FreeCAD.getUserAppDataDir(), "Mod",
                                         freecad_module_name[8:], "package.xml")
             if os.path.exists(MetadataFile):
-                meta = FreeCAD.Metadata(MetadataFile)
-                if not meta.supportsCurrentFreeCAD():
+                if not Cache.get(MetadataFile)["Supported"]:
                     continue
 
             if freecad_module_ispkg:
                 Log('Init: Initializing ' + freecad_module_name + '\n')
                 try:
+                    start = Profile.start()
                     freecad_module = importlib.import_module(freecad_module_name)
                     if any (module_name == 'init_gui' for _, module_name,
                             ispkg in pkgutil.iter_modules(freecad_module.__path__)):
                         importlib.import_module(freecad_module_name + '.init_gui')
                         Log('Init: Initializing ' + freecad_module_name + '... done\n')
+                        Profile.stop(freecad_module_name + '.init_gui', start)
                     else:
                         Log('Init: No init_gui module found in ' + freecad_module_name\
                             + ', skipping\n')
@@ -272,7 +278,10 @@ def InitApplications():
 
     Log("All modules with GUIs initialized using pkgutil are now initialized\n")
 
-def GeneratePackageIcon(dir:str, subdirectory:str, workbench_metadata:FreeCAD.Metadata,
+    Cache.save()
+    Profile.report("Gui")
+
+def GeneratePackageIcon(dir:str, subdirectory:str, workbench_metadata,
                         wb_handle:Workbench) -> None:
     relative_filename = workbench_metadata.Icon
     if not relative_filename:
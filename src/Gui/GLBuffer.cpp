@@ -119,13 +119,24 @@ void OpenGLBuffer::destroy()
     }
 }
 
-void OpenGLBuffer::allocate(const void *data, int count)
+void OpenGLBuffer::allocate(const void *data, intptr_t count)
 {
     if (bufferId > 0) {
         cc_glglue_glBufferData(glue, target, count, data, GL_STATIC_DRAW);
     }
 }
 
+/*!
+ * \brief OpenGLBuffer::write replaces \a count bytes of the bound buffer
+ * starting at \a offset. The buffer must have been allocated before.
+ */
+void OpenGLBuffer::write(intptr_t offset, const void *data, intptr_t count)
+{
+    if (bufferId > 0) {
+        cc_glglue_glBufferSubData(glue, target, offset, count, data);
+    }
+}
+
 bool OpenGLBuffer::bind()
 {
     if (bufferId) {
@@ -248,13 +259,20 @@ void OpenGLMultiBuffer::destroy()
     currentBuf = nullptr;
 }
 
-void OpenGLMultiBuffer::allocate(const void *data, int count)
+void OpenGLMultiBuffer::allocate(const void *data, intptr_t count)
 {
     if (currentBuf && *currentBuf) {
         cc_glglue_glBufferData(glue, target, count, data, GL_STATIC_DRAW);
     }
 }
 
+void OpenGLMultiBuffer::write(intptr_t offset, const void *data, intptr_t count)
+{
+    if (currentBuf && *currentBuf) {
+        cc_glglue_glBufferSubData(glue, target, offset, count, data);
+    }
+}
+
 bool OpenGLMultiBuffer::bind()
 {
     if (currentBuf && *currentBuf) {
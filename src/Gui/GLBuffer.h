@@ -25,6 +25,7 @@
 #define GUI_GLBUFFER_H
 
 #include <FCGlobal.h>
+#include <cstdint>
 #include <map>
 #include <Inventor/C/glue/gl.h>
 
@@ -43,7 +44,8 @@ public:
     bool isCreated() const;
 
     void destroy();
-    void allocate(const void *data, int count);
+    void allocate(const void *data, intptr_t count);
+    void write(intptr_t offset, const void *data, intptr_t count);
     bool bind();
     void release();
     GLuint getBufferId() const;
@@ -72,7 +74,8 @@ public:
     bool isCreated(uint32_t ctx) const;
 
     void destroy();
-    void allocate(const void *data, int count);
+    void allocate(const void *data, intptr_t count);
+    void write(intptr_t offset, const void *data, intptr_t count);
     bool bind();
     void release();
     GLuint getBufferId() const;
@@ -25,6 +25,7 @@
 # include <QEvent>
 # include <QGridLayout>
 # include <QTimer>
+# include <unordered_map>
 #endif
 
 #include <App/Document.h>
@@ -77,6 +78,7 @@ PropertyView::PropertyView(QWidget *parent)
     timer = new QTimer(this);
     timer->setSingleShot(true);
     connect(timer, &QTimer::timeout, this, &PropertyView::onTimer);
+    setBatchedSelection(true);
 
     tabs = new QTabWidget (this);
     tabs->setObjectName(QString::fromUtf8("propertyTab"));
@@ -215,7 +217,14 @@ void PropertyView::slotRollback() {
 void PropertyView::slotChangePropertyData(const App::Property& prop)
 {
     if (propertyEditorData->propOwners.count(prop.getContainer())) {
-        propertyEditorData->updateProperty(prop);
+        // A recompute may change the same properties many times, so only
+        // update them once it is done
+        auto obj = Base::freecad_dynamic_cast<App::DocumentObject>(prop.getContainer());
+        if (obj && obj->getDocument()
+                && obj->getDocument()->testStatus(App::Document::Recomputing))
+            pendingProps.insert(&prop);
+        else
+            propertyEditorData->updateProperty(prop);
         timer->start(ViewParams::instance()->getPropertyViewTimer());
     }
 }
@@ -248,6 +257,7 @@ void PropertyView::slotAppendDynamicProperty(const App::Property& prop)
 
 void PropertyView::slotRemoveDynamicProperty(const App::Property& prop)
 {
+    pendingProps.erase(&prop);
     App::PropertyContainer* parent = prop.getContainer();
     if(propertyEditorData->propOwners.count(parent))
         propertyEditorData->removeProperty(prop);
@@ -268,6 +278,7 @@ void PropertyView::slotChangePropertyEditor(const App::Document &, const App::Pr
 
 void PropertyView::slotDeleteDocument(const Gui::Document &doc) {
     if(propertyEditorData->propOwners.count(doc.getDocument())) {
+        pendingProps.clear();
         propertyEditorView->buildUp();
         propertyEditorData->buildUp();
         clearPropertyItemSelection();
@@ -277,6 +288,7 @@ void PropertyView::slotDeleteDocument(const Gui::Document &doc) {
 
 void PropertyView::slotDeletedViewObject(const Gui::ViewProvider &vp) {
     if(propertyEditorView->propOwners.count(&vp)) {
+        pendingProps.clear();
         propertyEditorView->buildUp();
         propertyEditorData->buildUp();
         clearPropertyItemSelection();
@@ -286,6 +298,7 @@ void PropertyView::slotDeletedViewObject(const Gui::ViewProvider &vp) {
 
 void PropertyView::slotDeletedObject(const App::DocumentObject &obj) {
     if(propertyEditorData->propOwners.count(&obj)) {
+        pendingProps.clear();
         propertyEditorView->buildUp();
         propertyEditorData->buildUp();
         clearPropertyItemSelection();
@@ -315,16 +328,6 @@ struct PropertyView::PropInfo
     std::vector<App::Property*> propList;
 };
 
-struct PropertyView::PropFind {
-    const PropInfo& item;
-    explicit PropFind(const PropInfo& item) : item(item) {}
-    bool operator () (const PropInfo& elem) const
-    {
-        return (elem.propId == item.propId) &&
-               (elem.propName == item.propName);
-    }
-};
-
 void PropertyView::onSelectionChanged(const SelectionChanges& msg)
 {
     if (msg.Type != SelectionChanges::AddSelection &&
@@ -337,6 +340,20 @@ void PropertyView::onSelectionChanged(const SelectionChanges& msg)
     timer->start(ViewParams::instance()->getPropertyViewTimer());
 }
 
+void PropertyView::onSelectionBatch(const std::vector<SelectionChanges>& msgs)
+{
+    // the properties are rebuilt from the whole selection on timeout
+    for (const auto& msg : msgs) {
+        if (msg.Type == SelectionChanges::AddSelection ||
+            msg.Type == SelectionChanges::RmvSelection ||
+            msg.Type == SelectionChanges::SetSelection ||
+            msg.Type == SelectionChanges::ClrSelection) {
+            onSelectionChanged(msg);
+            return;
+        }
+    }
+}
+
 void PropertyView::onTimer()
 {
     // See https://forum.freecad.org/viewtopic.php?f=8&t=72526
@@ -348,6 +365,9 @@ void PropertyView::onTimer()
 
     timer->stop();
 
+    std::unordered_set<const App::Property*> changedProps;
+    changedProps.swap(pendingProps);
+
     if(!this->isSelectionAttached()) {
         propertyEditorData->buildUp();
         propertyEditorView->buildUp();
@@ -382,6 +402,35 @@ void PropertyView::onTimer()
     // group the properties by <name,id>
     std::vector<PropInfo> propDataMap;
     std::vector<PropInfo> propViewMap;
+    std::unordered_map<std::string, std::size_t> propDataIndex;
+    std::unordered_map<std::string, std::size_t> propViewIndex;
+    bool firstObject = true;
+
+    // Only properties of the first object can be common to all objects, so
+    // the later objects only add to the existing entries.
+    auto addProperty = [&firstObject](std::vector<PropInfo>& propMap,
+                                      std::unordered_map<std::string, std::size_t>& propIndex,
+                                      const std::string& name,
+                                      App::Property* prop) {
+        if (isPropertyHidden(prop))
+            return;
+        int propId = prop->getTypeId().getKey();
+        auto pi = propIndex.find(name);
+        if (pi != propIndex.end()) {
+            auto& info = propMap[pi->second];
+            if (info.propId == propId)
+                info.propList.push_back(prop);
+        }
+        else if (firstObject) {
+            propIndex.emplace(name, propMap.size());
+            PropInfo nameType;
+            nameType.propName = name;
+            nameType.propId = propId;
+            nameType.propList.push_back(prop);
+            propMap.push_back(std::move(nameType));
+        }
+    };
+
     bool checkLink = true;
     ViewProviderDocumentObject *vpLast = nullptr;
     auto sels = Gui::Selection().getSelectionEx("*");
@@ -416,46 +465,12 @@ void PropertyView::onTimer()
         vp->getPropertyMap(viewList);
 
         // store the properties with <name,id> as key in a map
-        {
-            for (auto prop : dataList) {
-                if (isPropertyHidden(prop))
-                    continue;
-
-                PropInfo nameType;
-                nameType.propName = prop->getName();
-                nameType.propId = prop->getTypeId().getKey();
-
-                auto pi = std::find_if(propDataMap.begin(), propDataMap.end(), PropFind(nameType));
-                if (pi != propDataMap.end()) {
-                    pi->propList.push_back(prop);
-                }
-                else {
-                    nameType.propList.push_back(prop);
-                    propDataMap.push_back(nameType);
-                }
-            }
-        }
+        for (auto prop : dataList)
+            addProperty(propDataMap, propDataIndex, prop->getName(), prop);
         // the same for the view properties
-        {
-            std::map<std::string, App::Property*>::iterator pt;
-            for (pt = viewList.begin(); pt != viewList.end(); ++pt) {
-                if (isPropertyHidden(pt->second))
-                    continue;
-
-                PropInfo nameType;
-                nameType.propName = pt->first;
-                nameType.propId = pt->second->getTypeId().getKey();
-
-                auto pi = std::find_if(propViewMap.begin(), propViewMap.end(), PropFind(nameType));
-                if (pi != propViewMap.end()) {
-                    pi->propList.push_back(pt->second);
-                }
-                else {
-                    nameType.propList.push_back(pt->second);
-                    propViewMap.push_back(nameType);
-                }
-            }
-        }
+        for (auto &v : viewList)
+            addProperty(propViewMap, propViewIndex, v.first, v.second);
+        firstObject = false;
     }
 
     // the property must be part of each selected object, i.e. the number
@@ -535,6 +550,9 @@ void PropertyView::onTimer()
 
     propertyEditorView->buildUp(std::move(viewProps));
 
+    for (auto prop : changedProps)
+        propertyEditorData->updateProperty(*prop);
+
     // make sure the editors are enabled/disabled properly
     checkEnable();
 }
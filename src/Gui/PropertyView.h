@@ -23,6 +23,8 @@
 #ifndef GUI_DOCKWND_PROPERTYVIEW_H
 #define GUI_DOCKWND_PROPERTYVIEW_H
 
+#include <unordered_set>
+
 #include "DockWindow.h"
 #include "Selection.h"
 
@@ -78,6 +80,7 @@ protected:
 
 private:
     void onSelectionChanged(const SelectionChanges& msg) override;
+    void onSelectionBatch(const std::vector<SelectionChanges>& msgs) override;
     void slotChangePropertyData(const App::Property&);
     void slotChangePropertyView(const Gui::ViewProvider&, const App::Property&);
     void slotAppendDynamicProperty(const App::Property&);
@@ -93,7 +96,8 @@ private:
 
 private:
     struct PropInfo;
-    struct PropFind;
+    /// data properties changed during a recompute, updated by onTimer()
+    std::unordered_set<const App::Property*> pendingProps;
     using Connection = boost::signals2::connection;
     Connection connectPropData;
     Connection connectPropView;
@@ -25,6 +25,7 @@
 
 #ifndef _PreComp_
 # include <array>
+# include <map>
 # include <boost/algorithm/string/predicate.hpp>
 # include <QApplication>
 #endif
@@ -126,6 +127,16 @@ bool SelectionObserver::isSelectionAttached() const
     return connectSelection.connected();
 }
 
+void SelectionObserver::setBatchedSelection(bool enable)
+{
+    batchedSelection = enable;
+}
+
+bool SelectionObserver::isSelectionBatched() const
+{
+    return batchedSelection;
+}
+
 void SelectionObserver::attachSelection()
 {
     if (!connectSelection.connected()) {
@@ -137,6 +148,8 @@ void SelectionObserver::attachSelection()
         //NOLINTBEGIN
         connectSelection = signal.connect(std::bind
             (&SelectionObserver::_onSelectionChanged, this, sp::_1));
+        connectSelectionBatch = Selection().signalSelectionBatchDone.connect(std::bind
+            (&SelectionObserver::_onSelectionBatch, this));
         //NOLINTEND
 
         if (!filterDocName.empty()) {
@@ -150,7 +163,38 @@ void SelectionObserver::_onSelectionChanged(const SelectionChanges& msg) {
     try {
         if (blockedSelection)
             return;
+        if (batchedSelection && Selection().isSendingBatch()) {
+            batchedChanges.push_back(msg);
+            return;
+        }
+        onSelectionChanged(msg);
+    } catch (Base::Exception &e) {
+        e.ReportException();
+        FC_ERR("Unhandled Base::Exception caught in selection observer: ");
+    } catch (std::exception &e) {
+        FC_ERR("Unhandled std::exception caught in selection observer: " << e.what());
+    } catch (...) {
+        FC_ERR("Unhandled unknown exception caught in selection observer");
+    }
+}
+
+void SelectionObserver::onSelectionBatch(const std::vector<SelectionChanges>& msgs)
+{
+    for (const auto& msg : msgs) {
         onSelectionChanged(msg);
+    }
+}
+
+void SelectionObserver::_onSelectionBatch()
+{
+    if (batchedChanges.empty())
+        return;
+    std::vector<SelectionChanges> msgs;
+    msgs.swap(batchedChanges);
+    try {
+        if (blockedSelection)
+            return;
+        onSelectionBatch(msgs);
     } catch (Base::Exception &e) {
         e.ReportException();
         FC_ERR("Unhandled Base::Exception caught in selection observer: ");
@@ -163,6 +207,8 @@ void SelectionObserver::_onSelectionChanged(const SelectionChanges& msg) {
 
 void SelectionObserver::detachSelection()
 {
+    connectSelectionBatch.disconnect();
+    batchedChanges.clear();
     if (connectSelection.connected()) {
         connectSelection.disconnect();
         if (!filterDocName.empty())
@@ -393,44 +439,150 @@ void SelectionSingleton::enablePickedList(bool enable)
 
 void SelectionSingleton::notify(SelectionChanges &&Chng)
 {
+    if(BatchCount > 0) {
+        BatchQueue.push_back(std::move(Chng));
+        return;
+    }
     if(Notifying) {
         NotificationQueue.push_back(std::move(Chng));
         return;
     }
     Base::FlagToggler<bool> flag(Notifying);
     NotificationQueue.push_back(std::move(Chng));
+    sendNotificationQueue();
+}
+
+void SelectionSingleton::sendNotificationQueue()
+{
     while(!NotificationQueue.empty()) {
-        const auto &msg = NotificationQueue.front();
-        bool notify;
+        sendNotification(NotificationQueue.front());
+        NotificationQueue.pop_front();
+    }
+}
+
+void SelectionSingleton::sendNotification(const SelectionChanges &msg)
+{
+    // The selection may have changed again since the message was queued
+    bool notify;
+    switch(msg.Type) {
+    case SelectionChanges::AddSelection:
+        notify = isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
+        break;
+    case SelectionChanges::RmvSelection:
+        notify = !isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
+        break;
+    case SelectionChanges::SetPreselect:
+        notify = CurrentPreselection.Type==SelectionChanges::SetPreselect
+            && CurrentPreselection.Object == msg.Object;
+        break;
+    case SelectionChanges::RmvPreselect:
+        notify = CurrentPreselection.Type==SelectionChanges::ClrSelection;
+        break;
+    default:
+        notify = true;
+    }
+    if(notify) {
+        Notify(msg);
+        try {
+            signalSelectionChanged(msg);
+        }
+        catch (const boost::exception&) {
+            // reported by code analyzers
+            Base::Console().Warning("notify: Unexpected boost exception\n");
+        }
+    }
+}
+
+void SelectionSingleton::beginBatch()
+{
+    ++BatchCount;
+}
+
+void SelectionSingleton::endBatch()
+{
+    if(BatchCount <= 0 || --BatchCount > 0)
+        return;
+
+    auto msgs = takeBatch();
+    if(msgs.empty())
+        return;
+
+    if(Notifying) {
+        // Batch ended inside an observer, just queue the changes
+        for(auto &msg : msgs)
+            NotificationQueue.push_back(std::move(msg));
+        return;
+    }
+
+    Base::FlagToggler<bool> flag(Notifying);
+    {
+        Base::FlagToggler<bool> sending(SendingBatch);
+        for(const auto &msg : msgs)
+            sendNotification(msg);
+    }
+    try {
+        signalSelectionBatchDone();
+    }
+    catch (const boost::exception&) {
+        // reported by code analyzers
+        Base::Console().Warning("endBatch: Unexpected boost exception\n");
+    }
+    sendNotificationQueue();
+}
+
+std::vector<SelectionChanges> SelectionSingleton::takeBatch()
+{
+    std::vector<SelectionChanges> msgs;
+    msgs.swap(BatchQueue);
+
+    // An addition followed by a removal of the same element cancel each
+    // other out, and so do a removal followed by an addition, so that no
+    // observer is told about a removal of an element it never saw added.
+    // A clear makes earlier additions and removals in its document obsolete.
+    std::vector<bool> keep(msgs.size(), true);
+    std::map<App::SubObjectT, std::size_t> lastChange;
+    for(std::size_t i = 0; i < msgs.size(); ++i) {
+        const auto &msg = msgs[i];
         switch(msg.Type) {
         case SelectionChanges::AddSelection:
-            notify = isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
-            break;
-        case SelectionChanges::RmvSelection:
-            notify = !isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
-            break;
-        case SelectionChanges::SetPreselect:
-            notify = CurrentPreselection.Type==SelectionChanges::SetPreselect
-                && CurrentPreselection.Object == msg.Object;
+        case SelectionChanges::RmvSelection: {
+            auto res = lastChange.emplace(msg.Object, i);
+            if(!res.second) {
+                keep[res.first->second] = false;
+                if(msgs[res.first->second].Type != msg.Type) {
+                    keep[i] = false;
+                    lastChange.erase(res.first);
+                }
+                else
+                    res.first->second = i;
+            }
             break;
-        case SelectionChanges::RmvPreselect:
-            notify = CurrentPreselection.Type==SelectionChanges::ClrSelection;
+        }
+        case SelectionChanges::ClrSelection:
+            for(auto it = lastChange.begin(); it != lastChange.end();) {
+                if(!*msg.pDocName || it->first.getDocumentName() == msg.pDocName) {
+                    keep[it->second] = false;
+                    it = lastChange.erase(it);
+                }
+                else
+                    ++it;
+            }
             break;
         default:
-            notify = true;
+            break;
         }
-        if(notify) {
-            Notify(msg);
-            try {
-                signalSelectionChanged(msg);
-            }
-            catch (const boost::exception&) {
-                // reported by code analyzers
-                Base::Console().Warning("notify: Unexpected boost exception\n");
-            }
+    }
+
+    std::size_t count = 0;
+    for(std::size_t i = 0; i < msgs.size(); ++i) {
+        if(keep[i]) {
+            if(count != i)
+                msgs[count] = std::move(msgs[i]);
+            ++count;
         }
-        NotificationQueue.pop_front();
     }
+    msgs.resize(count);
+    return msgs;
 }
 
 bool SelectionSingleton::hasPickedList() const
@@ -1098,6 +1250,8 @@ std::vector<SelectionObject> SelectionSingleton::selStackGet(const char* pDocNam
 
 bool SelectionSingleton::addSelections(const char* pDocName, const char* pObjectName, const std::vector<std::string>& pSubNames)
 {
+    SelectionBatch batch;
+
     if(!_PickedList.empty()) {
         _PickedList.clear();
         notify(SelectionChanges(SelectionChanges::PickedListChanged));
@@ -1905,6 +2059,17 @@ PyMethodDef SelectionSingleton::Methods[] = {
      "    0: do not resolve, 1: resolve, 2: resolve with element map.\n"
      "index : int\n    Select stack index.\n"
      "    0: last pushed selection, > 0: trace back, < 0: trace forward."},
+    {"beginBatch",        (PyCFunction) SelectionSingleton::sBeginBatch, METH_VARARGS,
+     "beginBatch() -> None\n"
+     "\n"
+     "Hold back selection change notifications until the matching endBatch().\n"
+     "Calls can be nested, the changes are sent when the outermost batch ends.\n"
+     "Use try/finally to make sure endBatch() is called."},
+    {"endBatch",          (PyCFunction) SelectionSingleton::sEndBatch, METH_VARARGS,
+     "endBatch() -> None\n"
+     "\n"
+     "End a batch started by beginBatch(). Observers with a selectionBatch()\n"
+     "method receive all the changes of the batch in a single call."},
     {nullptr, nullptr, 0, nullptr}  /* Sentinel */
 };
 
@@ -2474,3 +2639,28 @@ PyObject *SelectionSingleton::sGetSelectionFromStack(PyObject * /*self*/, PyObje
     }
     PY_CATCH;
 }
+
+PyObject *SelectionSingleton::sBeginBatch(PyObject * /*self*/, PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return nullptr;
+
+    Selection().beginBatch();
+    Py_Return;
+}
+
+PyObject *SelectionSingleton::sEndBatch(PyObject * /*self*/, PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return nullptr;
+
+    PY_TRY {
+        if (!Selection().isBatching()) {
+            PyErr_SetString(PyExc_RuntimeError, "No selection batch to end");
+            return nullptr;
+        }
+        Selection().endBatch();
+        Py_Return;
+    }
+    PY_CATCH;
+}
@@ -250,6 +250,11 @@ public:
     bool blockSelection(bool block);
     bool isSelectionBlocked() const;
     bool isSelectionAttached() const;
+    /** Receive the changes made inside a SelectionBatch through onSelectionBatch()
+     * instead of one onSelectionChanged() call per change.
+     */
+    void setBatchedSelection(bool enable);
+    bool isSelectionBatched() const;
 
     /** Attaches to the selection. */
     void attachSelection();
@@ -258,15 +263,24 @@ public:
 
 private:
     virtual void onSelectionChanged(const SelectionChanges& msg) = 0;
+    /** Called once with all changes of a SelectionBatch, if enabled by
+     * setBatchedSelection(). The default implementation calls
+     * onSelectionChanged() for each change.
+     */
+    virtual void onSelectionBatch(const std::vector<SelectionChanges>& msgs);
     void _onSelectionChanged(const SelectionChanges& msg);
+    void _onSelectionBatch();
 
 private:
     using Connection = boost::signals2::connection;
     Connection connectSelection;
+    Connection connectSelectionBatch;
     std::string filterDocName;
     std::string filterObjName;
     ResolveMode resolve;
     bool blockedSelection;
+    bool batchedSelection = false;
+    std::vector<SelectionChanges> batchedChanges;
 };
 
 /** SelectionGate
@@ -442,6 +456,31 @@ public:
     boost::signals2::signal<void (const SelectionChanges& msg)> signalSelectionChanged2;
     /// signal on selection change with resolved object and sub element map
     boost::signals2::signal<void (const SelectionChanges& msg)> signalSelectionChanged3;
+    /// signal after all changes of a selection batch have been sent
+    boost::signals2::signal<void ()> signalSelectionBatchDone;
+
+    /** @name Selection batch functions
+     *
+     * Changes made between beginBatch() and the matching endBatch() are
+     * held back and sent when the outermost batch ends. Repeated changes of
+     * the same element are merged, and additions and removals made obsolete
+     * by a later clear are dropped. Observers can use setBatchedSelection()
+     * to receive all the changes of a batch at once.
+     */
+    //@{
+    void beginBatch();
+    void endBatch();
+    /// Check whether a batch has been started and not ended yet
+    bool isBatching() const
+    {
+        return BatchCount > 0;
+    }
+    /// Check whether the changes of a batch are being sent
+    bool isSendingBatch() const
+    {
+        return SendingBatch;
+    }
+    //@}
 
     /** Returns a vector of selection objects
      *
@@ -651,6 +690,8 @@ protected:
     static PyObject *sHasSelection        (PyObject *self,PyObject *args);
     static PyObject *sHasSubSelection     (PyObject *self,PyObject *args);
     static PyObject *sGetSelectionFromStack(PyObject *self,PyObject *args);
+    static PyObject *sBeginBatch          (PyObject *self,PyObject *args);
+    static PyObject *sEndBatch            (PyObject *self,PyObject *args);
 
 protected:
     /// Construction
@@ -671,8 +712,15 @@ protected:
     std::deque<SelectionChanges> NotificationQueue;
     bool Notifying = false;
 
+    std::vector<SelectionChanges> BatchQueue;
+    int BatchCount = 0;
+    bool SendingBatch = false;
+
     void notify(SelectionChanges &&Chng);
     void notify(const SelectionChanges &Chng) { notify(SelectionChanges(Chng)); }
+    void sendNotification(const SelectionChanges &msg);
+    void sendNotificationQueue();
+    std::vector<SelectionChanges> takeBatch();
 
     struct _SelObj {
         std::string DocName;
@@ -758,6 +806,21 @@ private:
     bool silent;
 };
 
+/** Helper class to send the selection changes of a scope at once
+ * @see SelectionSingleton::beginBatch()
+ */
+class GuiExport SelectionBatch {
+public:
+    SelectionBatch() {
+        Selection().beginBatch();
+    }
+    ~SelectionBatch() {
+        Selection().endBatch();
+    }
+    SelectionBatch(const SelectionBatch&) = delete;
+    SelectionBatch& operator=(const SelectionBatch&) = delete;
+};
+
 } //namespace Gui
 
 #endif // GUI_SELECTION_H
@@ -38,6 +38,8 @@ SelectionObserverPython::SelectionObserverPython(const Py::Object& obj, ResolveM
 #undef FC_PY_ELEMENT
 #define FC_PY_ELEMENT(_name) FC_PY_GetCallable(obj.ptr(),#_name,py_##_name);
     FC_PY_SEL_OBSERVER
+
+    setBatchedSelection(!py_selectionBatch.isNone());
 }
 
 SelectionObserverPython::~SelectionObserverPython() = default;
@@ -92,6 +94,60 @@ void SelectionObserverPython::onSelectionChanged(const SelectionChanges& msg)
     }
 }
 
+void SelectionObserverPython::onSelectionBatch(const std::vector<SelectionChanges>& msgs)
+{
+    Base::PyGILStateLocker lock;
+    try {
+        // One (type, docName, objName, subName) tuple per change, where type
+        // is the name of the observer method handling single changes
+        Py::List changes;
+        for (const auto& msg : msgs) {
+            const char* type = nullptr;
+            switch (msg.Type)
+            {
+            case SelectionChanges::AddSelection:
+                type = "addSelection";
+                break;
+            case SelectionChanges::RmvSelection:
+                type = "removeSelection";
+                break;
+            case SelectionChanges::SetSelection:
+                type = "setSelection";
+                break;
+            case SelectionChanges::ClrSelection:
+                type = "clearSelection";
+                break;
+            case SelectionChanges::SetPreselect:
+                type = "setPreselection";
+                break;
+            case SelectionChanges::RmvPreselect:
+                type = "removePreselection";
+                break;
+            case SelectionChanges::PickedListChanged:
+                type = "pickedListChanged";
+                break;
+            default:
+                continue;
+            }
+            Py::Tuple change(4);
+            change.setItem(0, Py::String(type));
+            change.setItem(1, Py::String(msg.pDocName ? msg.pDocName : ""));
+            change.setItem(2, Py::String(msg.pObjectName ? msg.pObjectName : ""));
+            change.setItem(3, Py::String(msg.pSubName ? msg.pSubName : ""));
+            changes.append(change);
+        }
+        if (changes.size() == 0)
+            return;
+        Py::Tuple args(1);
+        args.setItem(0, changes);
+        Base::pyCall(py_selectionBatch.ptr(),args.ptr());
+    }
+    catch (Py::Exception&) {
+        Base::PyException e; // extract the Python error text
+        e.ReportException();
+    }
+}
+
 void SelectionObserverPython::pickedListChanged()
 {
     if(py_pickedListChanged.isNone())
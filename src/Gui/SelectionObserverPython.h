@@ -50,6 +50,7 @@ public:
 
 private:
     void onSelectionChanged(const SelectionChanges& msg) override;
+    void onSelectionBatch(const std::vector<SelectionChanges>& msgs) override;
     void addSelection(const SelectionChanges&);
     void removeSelection(const SelectionChanges&);
     void setSelection(const SelectionChanges&);
@@ -69,7 +70,8 @@ private:
     FC_PY_ELEMENT(clearSelection) \
     FC_PY_ELEMENT(setPreselection) \
     FC_PY_ELEMENT(removePreselection) \
-    FC_PY_ELEMENT(pickedListChanged)
+    FC_PY_ELEMENT(pickedListChanged) \
+    FC_PY_ELEMENT(selectionBatch)
 
 #undef FC_PY_ELEMENT
 #define FC_PY_ELEMENT(_name) Py::Object py_##_name;
@@ -113,6 +113,8 @@ SelectionView::SelectionView(Gui::Document* pcDocument, QWidget* parent)
     connect(selectionView, &QListWidget::customContextMenuRequested, this, &SelectionView::onItemContextMenu);
     connect(enablePickList, &QCheckBox::stateChanged, this, &SelectionView::onEnablePickList);
     // clang-format on
+
+    setBatchedSelection(true);
 }
 
 SelectionView::~SelectionView() = default;
@@ -272,6 +274,16 @@ void SelectionView::onSelectionChanged(const SelectionChanges& Reason)
     countLabel->setText(QString::number(selectionView->count()));
 }
 
+void SelectionView::onSelectionBatch(const std::vector<SelectionChanges>& msgs)
+{
+    // repaint the list once for the whole batch
+    selectionView->setUpdatesEnabled(false);
+    for (const auto& msg : msgs) {
+        onSelectionChanged(msg);
+    }
+    selectionView->setUpdatesEnabled(true);
+}
+
 void SelectionView::search(const QString& text)
 {
     if (!text.isEmpty()) {
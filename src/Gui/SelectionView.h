@@ -61,6 +61,8 @@ public:
 
     /// Observer message from the Selection
     void onSelectionChanged(const SelectionChanges& msg) override;
+    /// Observer messages from a selection batch
+    void onSelectionBatch(const std::vector<SelectionChanges>& msgs) override;
 
     void leaveEvent(QEvent*) override;
 
@@ -58,6 +58,8 @@
 # include <Inventor/nodes/SoMaterialBinding.h>
 # include <Inventor/nodes/SoNormalBinding.h>
 # include <Inventor/nodes/SoPointSet.h>
+# include <Inventor/nodes/SoSwitch.h>
+# include <Inventor/nodes/SoTransform.h>
 # include <Inventor/threads/SbStorage.h>
 #endif
 
@@ -1302,10 +1304,7 @@ void SoFCSelectionRoot::renderPrivate(SoGLRenderAction * action, bool inPath) {
     }
     SelStack.push_back(this);
     if(_renderPrivate(action,inPath)) {
-        if(inPath)
-            SoSeparator::GLRenderInPath(action);
-        else
-            SoSeparator::GLRenderBelowPath(action);
+        renderChildren(action,inPath);
     }
     SelStack.pop_back();
     SelStack.nodeSet.erase(this);
@@ -1363,10 +1362,7 @@ bool SoFCSelectionRoot::_renderPrivate(SoGLRenderAction * action, bool inPath) {
     }
 
     if(!ctx) {
-        if(inPath)
-            SoSeparator::GLRenderInPath(action);
-        else
-            SoSeparator::GLRenderBelowPath(action);
+        renderChildren(action,inPath);
     } else {
         bool selPushed;
         bool hlPushed;
@@ -1391,10 +1387,7 @@ bool SoFCSelectionRoot::_renderPrivate(SoGLRenderAction * action, bool inPath) {
         if((hlPushed = ctx->hlAll))
             HlColorStack.push_back(ctx->hlColor);
 
-        if(inPath)
-            SoSeparator::GLRenderInPath(action);
-        else
-            SoSeparator::GLRenderBelowPath(action);
+        renderChildren(action,inPath);
 
         if(selPushed) {
             SelColorStack.pop_back();
@@ -1414,6 +1407,80 @@ bool SoFCSelectionRoot::_renderPrivate(SoGLRenderAction * action, bool inPath) {
     return false;
 }
 
+void SoFCSelectionRoot::renderChildren(SoGLRenderAction * action, bool inPath) {
+    if(inPath)
+        SoSeparator::GLRenderInPath(action);
+    else if(!instancing || !renderInstances(action))
+        SoSeparator::GLRenderBelowPath(action);
+}
+
+bool SoFCSelectionRoot::renderInstances(SoGLRenderAction * action) {
+    int threshold = ViewParams::instance()->getLinkArrayInstanceThreshold();
+    int numChildren = getNumChildren();
+    if(threshold <= 0 || numChildren < threshold)
+        return false;
+
+    // Returns the element root if the child can be rendered as a plain
+    // instance, i.e. a visible SoSwitch holding a SoFCSelectionRoot with a
+    // transform and the shared node, and nothing that requires the normal
+    // render path of the root.
+    auto getInstanceRoot = [](SoNode *child) -> SoFCSelectionRoot* {
+        if(!child->isOfType(SoSwitch::getClassTypeId()))
+            return nullptr;
+        auto sw = static_cast<SoSwitch*>(child);
+        if(sw->whichChild.getValue()!=0 || sw->getNumChildren()!=1)
+            return nullptr;
+        auto root = dynamic_cast<SoFCSelectionRoot*>(sw->getChild(0));
+        if(!root || root->overrideColor || root->instancing
+                 || root->getNumChildren()!=2
+                 || !root->getChild(0)->isOfType(SoTransform::getClassTypeId()))
+            return nullptr;
+        return root;
+    };
+
+    // The element separators are bypassed, which also means no render cache
+    // is kept at this level. Each instance still replays the render cache of
+    // the shared node with its own transform.
+    auto state = action->getState();
+    state->push();
+    for(int i=0; i<numChildren && !action->hasTerminated(); ++i) {
+        SoNode *child = getChild(i);
+        action->pushCurPath(i,child);
+        auto root = getInstanceRoot(child);
+        if(root) {
+            // The element root is still pushed to the stack, so that any
+            // selection context of the sub elements of the shared node can
+            // be found.
+            SelStack.push_back(root);
+            if(getNodeContext(SelStack,root,SoFCSelectionContextBasePtr())
+                    || getNodeContext2(SelStack,root,SelContext::merge))
+            {
+                SelStack.pop_back();
+                root = nullptr;
+            }
+        }
+        if(!root) {
+            action->traverse(child);
+            action->popCurPath();
+            continue;
+        }
+        action->pushCurPath(0,root);
+        state->push();
+        for(int j=0; j<2; ++j) {
+            SoNode *node = root->getChild(j);
+            action->pushCurPath(j,node);
+            action->traverse(node);
+            action->popCurPath();
+        }
+        state->pop();
+        action->popCurPath();
+        SelStack.pop_back();
+        action->popCurPath();
+    }
+    state->pop();
+    return true;
+}
+
 void SoFCSelectionRoot::GLRenderBelowPath(SoGLRenderAction * action) {
     renderPrivate(action,false);
 }
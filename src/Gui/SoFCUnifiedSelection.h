@@ -316,6 +316,25 @@ public:
         overrideColor = false;
     }
 
+    /** Enable the instance rendering path
+     *
+     * Meant for roots holding a large array of elements that share the same
+     * child node, e.g. a link array. Each element of the form SoSwitch ->
+     * SoFCSelectionRoot -> (SoTransform, node) is rendered by applying its
+     * transform and traversing the shared node directly, without the switch
+     * and separator overhead of the element. Elements with color override or
+     * selection context, and any other child, take the normal traversal. The
+     * path is used only if the number of children reaches the view parameter
+     * LinkArrayInstanceThreshold.
+     */
+    void setInstancing(bool enable) {
+        instancing = enable;
+    }
+
+    bool isInstancing() const {
+        return instancing;
+    }
+
     enum SelectStyles {
         Full, Box, PassThrough
     };
@@ -328,6 +347,8 @@ protected:
 
     void renderPrivate(SoGLRenderAction *, bool inPath);
     bool _renderPrivate(SoGLRenderAction *, bool inPath);
+    void renderChildren(SoGLRenderAction *, bool inPath);
+    bool renderInstances(SoGLRenderAction *);
 
     class Stack : public std::vector<SoNode*> {
     public:
@@ -370,6 +391,7 @@ protected:
     SbColor colorOverride;
     float transOverride = 0.0f;
     SoColorPacker shapeColorPacker;
+    bool instancing = false;
 
     bool doActionPrivate(Stack &stack, SoAction *);
 };
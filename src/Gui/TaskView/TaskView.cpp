@@ -304,6 +304,9 @@ TaskView::TaskView(QWidget *parent)
     connectApplicationRedoDocument = 
     App::GetApplication().signalRedoDocument.connect
         (std::bind(&Gui::TaskView::TaskView::slotRedoDocument, this, sp::_1));
+    connectSelectionBatchDone =
+    Gui::Selection().signalSelectionBatchDone.connect
+        (std::bind(&Gui::TaskView::TaskView::slotSelectionBatchDone, this));
     //NOLINTEND
 
     updateWatcher();
@@ -316,6 +319,7 @@ TaskView::~TaskView()
     connectApplicationClosedView.disconnect();
     connectApplicationUndoDocument.disconnect();
     connectApplicationRedoDocument.disconnect();
+    connectSelectionBatchDone.disconnect();
     Gui::Selection().Detach(this);
 }
 
@@ -550,13 +554,27 @@ void TaskView::OnChange(Gui::SelectionSingleton::SubjectType &rCaller,
         Reason.Type == SelectionChanges::SetSelection ||
         Reason.Type == SelectionChanges::RmvSelection) {
 
-        if (!ActiveDialog)
-            updateWatcher();
+        if (!ActiveDialog) {
+            // update once for all the changes of a selection batch
+            if (Gui::Selection().isSendingBatch())
+                pendingWatcherUpdate = true;
+            else
+                updateWatcher();
+        }
     }
 
 }
 /// @endcond
 
+void TaskView::slotSelectionBatchDone()
+{
+    if (!pendingWatcherUpdate)
+        return;
+    pendingWatcherUpdate = false;
+    if (!ActiveDialog)
+        updateWatcher();
+}
+
 void TaskView::showDialog(TaskDialog *dlg)
 {
     // if trying to open the same dialog twice nothing needs to be done
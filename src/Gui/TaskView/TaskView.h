@@ -187,6 +187,7 @@ private:
     void slotViewClosed(const Gui::MDIView*);
     void slotUndoDocument(const App::Document&);
     void slotRedoDocument(const App::Document&);
+    void slotSelectionBatchDone();
     void transactionChangeOnDocument(const App::Document&);
 
 protected:
@@ -209,12 +210,15 @@ protected:
     TaskEditControl *ActiveCtrl;
     bool restoreWidth = false;
     int currentWidth = 0;
+    /// the watchers need updating at the end of the current selection batch
+    bool pendingWatcherUpdate = false;
 
     Connection connectApplicationActiveDocument;
     Connection connectApplicationDeleteDocument;
     Connection connectApplicationClosedView;
     Connection connectApplicationUndoDocument;
     Connection connectApplicationRedoDocument;
+    Connection connectSelectionBatchDone;
 };
 
 } //namespace TaskView
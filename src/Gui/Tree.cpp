@@ -617,6 +617,7 @@ TreeWidget::TreeWidget(const char* name, QWidget* parent)
     Instances.insert(this);
     if (!_LastSelectedTreeWidget)
         _LastSelectedTreeWidget = this;
+    setBatchedSelection(true);
 
     this->setDragEnabled(true);
     this->setAcceptDrops(true);
@@ -3233,6 +3234,22 @@ void TreeWidget::onItemCollapsed(QTreeWidgetItem* item)
     }
 }
 
+// Apply the status of the items shown by expanding 'item', including those
+// below children that were already expanded.
+static void testExposedStatus(QTreeWidgetItem* item)
+{
+    for (int i = 0, count = item->childCount(); i < count; ++i) {
+        auto child = item->child(i);
+        if (child->type() != TreeWidget::ObjectType)
+            continue;
+        auto objItem = static_cast<DocumentObjectItem*>(child);
+        if (objItem->isStatusPending())
+            objItem->testStatus(true);
+        if (objItem->isExpanded())
+            testExposedStatus(objItem);
+    }
+}
+
 void TreeWidget::onItemExpanded(QTreeWidgetItem* item)
 {
     // object item expanded
@@ -3241,6 +3258,8 @@ void TreeWidget::onItemExpanded(QTreeWidgetItem* item)
         objItem->setExpandedStatus(true);
         objItem->getOwnerDocument()->populateItem(objItem, false, false);
     }
+    if (item)
+        testExposedStatus(item);
 }
 
 void TreeWidget::scrollItemToTop()
@@ -3598,6 +3617,25 @@ void TreeWidget::onSelectionChanged(const SelectionChanges& msg)
     }
 }
 
+void TreeWidget::onSelectionBatch(const std::vector<SelectionChanges>& msgs)
+{
+    // The tree is synced with the whole selection on timeout, so one
+    // change is enough to schedule it for the batch
+    for (const auto& msg : msgs) {
+        switch (msg.Type)
+        {
+        case SelectionChanges::AddSelection:
+        case SelectionChanges::RmvSelection:
+        case SelectionChanges::SetSelection:
+        case SelectionChanges::ClrSelection:
+            onSelectionChanged(msg);
+            return;
+        default:
+            break;
+        }
+    }
+}
+
 // ----------------------------------------------------------------------------
 
 /* TRANSLATOR Gui::TreePanel */
@@ -5309,8 +5347,30 @@ enum Status {
 };
 }
 
+bool DocumentObjectItem::isStatusPending() const
+{
+    return previousStatus < 0;
+}
+
+bool DocumentObjectItem::isExposed() const
+{
+    for (auto item = QTreeWidgetItem::parent(); item; item = item->parent()) {
+        if (!item->isExpanded())
+            return false;
+    }
+    return true;
+}
+
 void DocumentObjectItem::testStatus(bool resetStatus, QIcon& icon1, QIcon& icon2)
 {
+    // Building the icons is expensive, and large documents have far more items
+    // than are ever shown. Items inside a collapsed parent are therefore only
+    // marked here, and updated by TreeWidget::onItemExpanded().
+    if (!isExposed()) {
+        previousStatus = -1;
+        return;
+    }
+
     App::DocumentObject* pObject = object()->getObject();
 
     int visible = -1;
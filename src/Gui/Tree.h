@@ -129,6 +129,8 @@ public:
 protected:
     /// Observer message from the Selection
     void onSelectionChanged(const SelectionChanges& msg) override;
+    /// Observer messages from a selection batch
+    void onSelectionBatch(const std::vector<SelectionChanges>& msgs) override;
     void contextMenuEvent (QContextMenuEvent * e) override;
     void drawRow(QPainter *, const QStyleOptionViewItem &, const QModelIndex &) const override;
     /** @name Drag and drop */
@@ -413,6 +415,10 @@ public:
     Gui::ViewProviderDocumentObject* object() const;
     void testStatus(bool resetStatus, QIcon &icon1, QIcon &icon2);
     void testStatus(bool resetStatus);
+    /// true if the status has not been applied yet because the item is inside a collapsed parent
+    bool isStatusPending() const;
+    /// true if all parents of the item are expanded
+    bool isExposed() const;
     void displayStatusInfo();
     void setExpandedStatus(bool);
     void setData(int column, int role, const QVariant & value) override;
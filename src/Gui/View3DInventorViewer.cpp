@@ -512,6 +512,7 @@ void View3DInventorViewer::init()
 #endif
 
     inventorSelection = std::make_unique<View3DInventorSelection>(selectionRoot);
+    setBatchedSelection(true);
 
     pcClipPlane = nullptr;
 
@@ -793,6 +794,25 @@ void View3DInventorViewer::onSelectionChanged(const SelectionChanges & reason)
         cAct.apply(pcViewProviderRoot);
     }
 }
+
+void View3DInventorViewer::onSelectionBatch(const std::vector<SelectionChanges> & Reasons)
+{
+    // Hold back notification at the selection root while the whole batch is
+    // applied, so that the scene graph is only touched once
+    SbBool autonotify = selectionRoot->enableNotify(FALSE);
+    try {
+        for (const auto& Reason : Reasons) {
+            onSelectionChanged(Reason);
+        }
+    }
+    catch (...) {
+        selectionRoot->enableNotify(autonotify);
+        selectionRoot->touch();
+        throw;
+    }
+    selectionRoot->enableNotify(autonotify);
+    selectionRoot->touch();
+}
 /// @endcond
 
 bool View3DInventorViewer::searchNode(SoNode* node) const
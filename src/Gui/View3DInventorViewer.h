@@ -142,6 +142,8 @@ public:
 
     /// Observer message from the Selection
     void onSelectionChanged(const SelectionChanges &Reason) override;
+    /// Observer messages from a selection batch
+    void onSelectionBatch(const std::vector<SelectionChanges> &Reasons) override;
 
     SoDirectionalLight* getBacklight() const;
     void setBacklightEnabled(bool on);
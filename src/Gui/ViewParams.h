@@ -60,6 +60,7 @@ public:
     FC_VIEW_PARAM(DefaultShapeLineWidth,int,Int,2) \
     FC_VIEW_PARAM(DefaultShapePointSize,int,Int,2) \
     FC_VIEW_PARAM(CoinCycleCheck,bool,Bool,true) \
+    FC_VIEW_PARAM(LinkArrayInstanceThreshold,int,Int,64) \
     FC_VIEW_PARAM(EnablePropertyViewForInactiveDocument,bool,Bool,true) \
     FC_VIEW_PARAM(ShowSelectionBoundingBox,bool,Bool,false) \
     FC_VIEW_PARAM(PropertyViewTimer, unsigned long, Unsigned, 100) \
@@ -887,6 +887,10 @@ LinkView::LinkView()
     ,childType((SnapshotType)-1),autoSubLink(true)
 {
     pcLinkRoot = new SoFCSelectionRoot;
+    // Array elements share the same linked node, so let the root render them
+    // as plain instances when the array is large. Picking and selection still
+    // go through the per element nodes.
+    pcLinkRoot->setInstancing(true);
 }
 
 LinkView::~LinkView() {
@@ -442,10 +442,11 @@ void PropertyModel::insertOrMoveChildren()
             }
             else {
                 flushInserts();
-                int oldRow = item->row();
                 // Dynamic property can rename group, so must check
                 auto groupItem = item->parent();
                 assert(groupItem);
+                // Most items stay in place, so avoid the linear search of row()
+                int oldRow = groupItem->child(row) == item ? row : item->row();
                 if (oldRow == row && groupItem == groupInfo.groupItem) {
                     if (beginChange < 0) {
                         beginChange = row;
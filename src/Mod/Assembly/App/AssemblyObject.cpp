@@ -137,6 +137,9 @@ int AssemblyObject::solve(bool enableRedo, bool updateJCS)
 {
     ensureIdentityPlacements();
 
+    // TODO: keep the solver model between solves and only push the parts and joints that
+    // changed. The ASMT objects keep state from runKINEMATIC(), so reusing them needs
+    // validation against OndselSolver first.
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
     motions.clear();
@@ -927,17 +930,8 @@ bool AssemblyObject::isObjInSetOfObjRefs(App::DocumentObject* obj, const std::ve
 void AssemblyObject::removeUnconnectedJoints(std::vector<App::DocumentObject*>& joints,
                                              std::unordered_set<App::DocumentObject*> groundedObjs)
 {
-    std::vector<ObjRef> connectedParts;
-
-    // Initialize connectedParts with groundedObjs
-    for (auto* groundedObj : groundedObjs) {
-        connectedParts.push_back({groundedObj, nullptr});
-    }
-
-    // Perform a traversal from each grounded object
-    for (auto* groundedObj : groundedObjs) {
-        traverseAndMarkConnectedParts(groundedObj, connectedParts, joints);
-    }
+    JointConnectivity connectivity = makeJointConnectivity(joints);
+    auto connectedParts = getPartsConnectedToGround(connectivity, groundedObjs);
 
     // Filter out unconnected joints
     joints.erase(
@@ -945,10 +939,9 @@ void AssemblyObject::removeUnconnectedJoints(std::vector<App::DocumentObject*>&
             joints.begin(),
             joints.end(),
             [&](App::DocumentObject* joint) {
-                App::DocumentObject* obj1 = getMovingPartFromRef(this, joint, "Reference1");
-                App::DocumentObject* obj2 = getMovingPartFromRef(this, joint, "Reference2");
-                if (!isObjInSetOfObjRefs(obj1, connectedParts)
-                    || !isObjInSetOfObjRefs(obj2, connectedParts)) {
+                const auto& parts = connectivity.jointParts[joint];
+                if (!parts.first || !parts.second || connectedParts.count(parts.first) == 0
+                    || connectedParts.count(parts.second) == 0) {
                     Base::Console().Warning(
                         "%s is unconnected to a grounded part so it is ignored.\n",
                         joint->getFullName());
@@ -959,21 +952,93 @@ void AssemblyObject::removeUnconnectedJoints(std::vector<App::DocumentObject*>&
         joints.end());
 }
 
+AssemblyObject::JointConnectivity
+AssemblyObject::makeJointConnectivity(const std::vector<App::DocumentObject*>& joints)
+{
+    JointConnectivity connectivity;
+
+    for (auto* joint : joints) {
+        if (!joint) {
+            continue;
+        }
+
+        App::DocumentObject* obj1 = getMovingPartFromRef(this, joint, "Reference1");
+        App::DocumentObject* obj2 = getMovingPartFromRef(this, joint, "Reference2");
+        connectivity.jointParts[joint] = {obj1, obj2};
+        if (!isJointTypeConnecting(joint)) {
+            continue;
+        }
+
+        auto* ref1 = dynamic_cast<App::PropertyXLinkSub*>(joint->getPropertyByName("Reference1"));
+        auto* ref2 = dynamic_cast<App::PropertyXLinkSub*>(joint->getPropertyByName("Reference2"));
+        if (obj1 && obj2 && ref2) {
+            connectivity.connectedParts[obj1].push_back({obj2, ref2});
+        }
+        if (obj1 && obj2 && obj1 != obj2 && ref1) {
+            connectivity.connectedParts[obj2].push_back({obj1, ref1});
+        }
+    }
+
+    return connectivity;
+}
+
 void AssemblyObject::traverseAndMarkConnectedParts(App::DocumentObject* currentObj,
                                                    std::vector<ObjRef>& connectedParts,
                                                    const std::vector<App::DocumentObject*>& joints)
 {
-    // getConnectedParts returns the objs connected to the currentObj by any joint
-    auto connectedObjs = getConnectedParts(currentObj, joints);
-    for (auto& nextObjRef : connectedObjs) {
-        if (!isObjInSetOfObjRefs(nextObjRef.obj, connectedParts)) {
-            // Create a new ObjRef with the nextObj and a nullptr for PropertyXLinkSub*
+    std::unordered_set<App::DocumentObject*> visited;
+    for (const auto& objRef : connectedParts) {
+        visited.insert(objRef.obj);
+    }
+
+    traverseAndMarkConnectedParts(currentObj,
+                                  makeJointConnectivity(joints),
+                                  connectedParts,
+                                  visited);
+}
+
+void AssemblyObject::traverseAndMarkConnectedParts(
+    App::DocumentObject* currentObj,
+    const JointConnectivity& connectivity,
+    std::vector<ObjRef>& connectedParts,
+    std::unordered_set<App::DocumentObject*>& visited)
+{
+    auto it = connectivity.connectedParts.find(currentObj);
+    if (it == connectivity.connectedParts.end()) {
+        return;
+    }
+
+    for (const auto& nextObjRef : it->second) {
+        if (visited.insert(nextObjRef.obj).second) {
             connectedParts.push_back(nextObjRef);
-            traverseAndMarkConnectedParts(nextObjRef.obj, connectedParts, joints);
+            traverseAndMarkConnectedParts(nextObjRef.obj, connectivity, connectedParts, visited);
         }
     }
 }
 
+std::unordered_set<App::DocumentObject*>
+AssemblyObject::getPartsConnectedToGround(
+    const JointConnectivity& connectivity,
+    const std::unordered_set<App::DocumentObject*>& groundedObjs)
+{
+    std::vector<ObjRef> connectedParts;
+    std::unordered_set<App::DocumentObject*> visited;
+
+    // Initialize connectedParts with groundedObjs
+    for (auto* groundedObj : groundedObjs) {
+        if (groundedObj && visited.insert(groundedObj).second) {
+            connectedParts.push_back({groundedObj, nullptr});
+        }
+    }
+
+    // Perform a traversal from each grounded object
+    for (auto* groundedObj : groundedObjs) {
+        traverseAndMarkConnectedParts(groundedObj, connectivity, connectedParts, visited);
+    }
+
+    return visited;
+}
+
 std::vector<ObjRef>
 AssemblyObject::getConnectedParts(App::DocumentObject* part,
                                   const std::vector<App::DocumentObject*>& joints)
@@ -1034,28 +1099,11 @@ bool AssemblyObject::isPartConnected(App::DocumentObject* obj)
         return false;
     }
 
-    auto groundedObjs = getGroundedParts();
     std::vector<App::DocumentObject*> joints = getJoints(false);
+    auto connectedParts =
+        getPartsConnectedToGround(makeJointConnectivity(joints), getGroundedParts());
 
-    std::vector<ObjRef> connectedParts;
-
-    // Initialize connectedParts with groundedObjs
-    for (auto* groundedObj : groundedObjs) {
-        connectedParts.push_back({groundedObj, nullptr});
-    }
-
-    // Perform a traversal from each grounded object
-    for (auto* groundedObj : groundedObjs) {
-        traverseAndMarkConnectedParts(groundedObj, connectedParts, joints);
-    }
-
-    for (auto& objRef : connectedParts) {
-        if (obj == objRef.obj) {
-            return true;
-        }
-    }
-
-    return false;
+    return connectedParts.count(obj) > 0;
 }
 
 void AssemblyObject::jointParts(std::vector<App::DocumentObject*> joints)
@@ -1880,13 +1928,18 @@ std::vector<ObjRef> AssemblyObject::getDownstreamParts(App::DocumentObject* part
     }
 
     std::vector<App::DocumentObject*> joints = getJoints(false);
+    JointConnectivity connectivity = makeJointConnectivity(joints);
 
     std::vector<ObjRef> connectedParts = {{part, nullptr}};
-    traverseAndMarkConnectedParts(part, connectedParts, joints);
+    std::unordered_set<App::DocumentObject*> visited = {part};
+    traverseAndMarkConnectedParts(part, connectivity, connectedParts, visited);
+
+    // The parts that are still connected to ground without the joint
+    auto groundConnectedParts = getPartsConnectedToGround(connectivity, getGroundedParts());
 
     std::vector<ObjRef> downstreamParts;
     for (auto& parti : connectedParts) {
-        if (!isPartConnected(parti.obj) && (parti.obj != part)) {
+        if (groundConnectedParts.count(parti.obj) == 0 && (parti.obj != part)) {
             downstreamParts.push_back(parti);
         }
     }
@@ -190,6 +190,24 @@ public:
     std::vector<App::DocumentObject*> getMotionsFromSimulation(App::DocumentObject* sim);
 
 private:
+    // The moving parts of the joints and the parts connected to each part by a joint, so that
+    // the connectivity queries resolve the references of every joint only once.
+    struct JointConnectivity
+    {
+        std::unordered_map<App::DocumentObject*,
+                           std::pair<App::DocumentObject*, App::DocumentObject*>>
+            jointParts;
+        std::unordered_map<App::DocumentObject*, std::vector<ObjRef>> connectedParts;
+    };
+    JointConnectivity makeJointConnectivity(const std::vector<App::DocumentObject*>& joints);
+    void traverseAndMarkConnectedParts(App::DocumentObject* currentPart,
+                                       const JointConnectivity& connectivity,
+                                       std::vector<ObjRef>& connectedParts,
+                                       std::unordered_set<App::DocumentObject*>& visited);
+    std::unordered_set<App::DocumentObject*>
+    getPartsConnectedToGround(const JointConnectivity& connectivity,
+                              const std::unordered_set<App::DocumentObject*>& groundedObjs);
+
     std::shared_ptr<MbD::ASMTAssembly> mbdAssembly;
 
     std::unordered_map<App::DocumentObject*, MbDPartData> objectPartMap;
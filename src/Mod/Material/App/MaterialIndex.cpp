@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFuture>
+#include <QSaveFile>
+#include <QtConcurrentRun>
+#endif
+
+#include <App/Application.h>
+
+#include "MaterialIndex.h"
+
+
+using namespace Materials;
+
+namespace
+{
+const quint32 IndexMagic = 0x464d4958;  // "FMIX"
+const quint32 IndexVersion = 1;
+
+QFuture<void>& pendingSave()
+{
+    static QFuture<void> future;
+    return future;
+}
+
+QDataStream& operator<<(QDataStream& stream, const MaterialIndexEntry& entry)
+{
+    stream << entry.path << entry.modified << entry.size << entry.uuid << entry.parentUuid
+           << entry.author << entry.license << entry.description << entry.physicalModels
+           << entry.appearanceModels;
+    return stream;
+}
+
+QDataStream& operator>>(QDataStream& stream, MaterialIndexEntry& entry)
+{
+    stream >> entry.path >> entry.modified >> entry.size >> entry.uuid >> entry.parentUuid
+        >> entry.author >> entry.license >> entry.description >> entry.physicalModels
+        >> entry.appearanceModels;
+    return stream;
+}
+}  // namespace
+
+MaterialIndex::MaterialIndex()
+    : MaterialIndex(defaultFileName())
+{}
+
+MaterialIndex::MaterialIndex(const QString& fileName)
+    : _fileName(fileName)
+    , _modified(false)
+{
+    load();
+}
+
+QString MaterialIndex::defaultFileName()
+{
+    return QString::fromStdString(App::Application::getUserCachePath() + "MaterialIndex.dat");
+}
+
+void MaterialIndex::load()
+{
+    // Don't read a file that is still being written
+    waitForSave();
+
+    QFile file(_fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_6);
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (magic != IndexMagic || version != IndexVersion) {
+        // Rebuilt from the cards
+        _modified = true;
+        return;
+    }
+
+    quint32 count = 0;
+    stream >> count;
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; i++) {
+        MaterialIndexEntry entry;
+        stream >> entry;
+        _entries[entry.path] = entry;
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        _entries.clear();
+        _modified = true;
+    }
+}
+
+const MaterialIndexEntry* MaterialIndex::find(const QFileInfo& file)
+{
+    QString path = file.canonicalFilePath();
+    _used.insert(path);
+
+    auto it = _entries.find(path);
+    if (it == _entries.end()) {
+        return nullptr;
+    }
+
+    const auto& entry = it->second;
+    if (entry.modified != file.lastModified().toMSecsSinceEpoch() || entry.size != file.size()) {
+        return nullptr;
+    }
+    return &entry;
+}
+
+void MaterialIndex::update(const MaterialIndexEntry& entry)
+{
+    _used.insert(entry.path);
+    _entries[entry.path] = entry;
+    _modified = true;
+}
+
+void MaterialIndex::save()
+{
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        if (_used.count(it->first) == 0) {
+            it = _entries.erase(it);
+            _modified = true;
+        }
+        else {
+            ++it;
+        }
+    }
+
+    if (!_modified) {
+        return;
+    }
+
+    waitForSave();
+    pendingSave() = QtConcurrent::run([fileName = _fileName, entries = _entries]() {
+        write(fileName, entries);
+    });
+    _modified = false;
+}
+
+void MaterialIndex::waitForSave()
+{
+    pendingSave().waitForFinished();
+}
+
+void MaterialIndex::write(const QString& fileName,
+                          const std::map<QString, MaterialIndexEntry>& entries)
+{
+    QDir().mkpath(QFileInfo(fileName).absolutePath());
+
+    // The index is replaced in one step, so other instances never see a partial file
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream << IndexMagic << IndexVersion << static_cast<quint32>(entries.size());
+    for (const auto& it : entries) {
+        stream << it.second;
+    }
+
+    if (stream.status() == QDataStream::Ok) {
+        file.commit();
+    }
+    else {
+        file.cancelWriting();
+    }
+}
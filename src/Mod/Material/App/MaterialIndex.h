@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MATERIAL_MATERIALINDEX_H
+#define MATERIAL_MATERIALINDEX_H
+
+#include <map>
+#include <set>
+
+#include <QFileInfo>
+#include <QString>
+#include <QStringList>
+
+#include <Mod/Material/MaterialGlobal.h>
+
+namespace Materials
+{
+
+/*
+ * The library index records what is needed to list a material without
+ * reading its card. The values of the properties are read from the card
+ * when they are first used.
+ */
+struct MaterialsExport MaterialIndexEntry
+{
+    QString path;
+    qint64 modified = 0;
+    qint64 size = 0;
+    QString uuid;
+    QString parentUuid;
+    QString author;
+    QString license;
+    QString description;
+    QStringList physicalModels;
+    QStringList appearanceModels;
+};
+
+class MaterialsExport MaterialIndex
+{
+public:
+    MaterialIndex();
+    explicit MaterialIndex(const QString& fileName);
+    ~MaterialIndex() = default;
+
+    /*
+     * Return the entry for the file, or nullptr if there is none or the file
+     * has been modified since it was indexed
+     */
+    const MaterialIndexEntry* find(const QFileInfo& file);
+    /*
+     * Add or replace the entry for a file that was read from its card
+     */
+    void update(const MaterialIndexEntry& entry);
+    /*
+     * Drop the entries of the files that were not looked up, and write the
+     * index if it changed. The file is written in the background.
+     */
+    void save();
+    bool isModified() const
+    {
+        return _modified;
+    }
+    std::size_t size() const
+    {
+        return _entries.size();
+    }
+
+    /*
+     * Wait for a pending write of the index to finish
+     */
+    static void waitForSave();
+    static QString defaultFileName();
+
+private:
+    void load();
+    static void write(const QString& fileName,
+                      const std::map<QString, MaterialIndexEntry>& entries);
+
+    QString _fileName;
+    std::map<QString, MaterialIndexEntry> _entries;
+    std::set<QString> _used;
+    bool _modified;
+};
+
+}  // namespace Materials
+
+#endif  // MATERIAL_MATERIALINDEX_H
@@ -21,6 +21,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <QDateTime>
 #include <QDirIterator>
 #include <QFileInfo>
 #include <QList>
@@ -167,10 +168,6 @@ std::shared_ptr<Material3DArray> MaterialYamlEntry::read3DArray(const YAML::Node
 void MaterialYamlEntry::addToTree(
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap)
 {
-    std::set<QString> exclude;
-    exclude.insert(QString::fromStdString("General"));
-    exclude.insert(QString::fromStdString("Inherits"));
-
     auto yamlModel = getModel();
     auto library = getLibrary();
     auto name = getName();
@@ -208,36 +205,66 @@ void MaterialYamlEntry::addToTree(
             auto modelNode = models[modelName];
             auto modelUUID = modelNode["UUID"].as<std::string>();
             finalModel->addPhysical(QString::fromStdString(modelUUID));
+        }
+    }
+
+    // Add appearance models
+    if (yamlModel["AppearanceModels"]) {
+        auto models = yamlModel["AppearanceModels"];
+        for (auto it = models.begin(); it != models.end(); it++) {
+            auto modelName = (it->first).as<std::string>();
+
+            // Add the model uuid
+            auto modelNode = models[modelName];
+            auto modelUUID = modelNode["UUID"].as<std::string>();
+            finalModel->addAppearance(QString::fromStdString(modelUUID));
+        }
+    }
+
+    readProperties(*finalModel, yamlModel);
+
+    QString path = QDir(directory).absolutePath();
+    (*materialMap)[uuid] = library->addMaterial(finalModel, path);
+}
+
+void MaterialYamlEntry::readProperties(Material& finalModel, const YAML::Node& yamlModel)
+{
+    auto name = finalModel.getName();
+
+    // Add the physical property values
+    if (yamlModel["Models"]) {
+        auto models = yamlModel["Models"];
+        for (auto it = models.begin(); it != models.end(); it++) {
+            auto modelName = (it->first).as<std::string>();
 
-            // Add the property values
             auto properties = yamlModel["Models"][modelName];
             for (auto itp = properties.begin(); itp != properties.end(); itp++) {
                 auto propertyName = (itp->first).as<std::string>();
-                if (finalModel->hasPhysicalProperty(QString::fromStdString(propertyName))) {
+                if (finalModel.hasPhysicalProperty(QString::fromStdString(propertyName))) {
                     auto prop =
-                        finalModel->getPhysicalProperty(QString::fromStdString(propertyName));
+                        finalModel.getPhysicalProperty(QString::fromStdString(propertyName));
                     auto type = prop->getType();
 
                     try {
                         if (type == MaterialValue::List || type == MaterialValue::FileList) {
                             auto list = readList(itp->second);
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
-                                                         list);
+                            finalModel.setPhysicalValue(QString::fromStdString(propertyName),
+                                                        list);
                         }
                         else if (type == MaterialValue::ImageList) {
                             auto list = readImageList(itp->second);
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
-                                                         list);
+                            finalModel.setPhysicalValue(QString::fromStdString(propertyName),
+                                                        list);
                         }
                         else if (type == MaterialValue::Array2D) {
                             auto array2d = read2DArray(itp->second, prop->columns());
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
-                                                         array2d);
+                            finalModel.setPhysicalValue(QString::fromStdString(propertyName),
+                                                        array2d);
                         }
                         else if (type == MaterialValue::Array3D) {
                             auto array3d = read3DArray(itp->second, prop->columns());
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
-                                                         array3d);
+                            finalModel.setPhysicalValue(QString::fromStdString(propertyName),
+                                                        array3d);
                         }
                         else {
                             QString propertyValue =
@@ -246,8 +273,8 @@ void MaterialYamlEntry::addToTree(
                                 propertyValue = propertyValue.remove(
                                     QRegularExpression(QString::fromStdString("[\r\n]")));
                             }
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
-                                                         propertyValue);
+                            finalModel.setPhysicalValue(QString::fromStdString(propertyName),
+                                                        propertyValue);
                         }
                     }
                     catch (const YAML::BadConversion& e) {
@@ -265,46 +292,40 @@ void MaterialYamlEntry::addToTree(
         }
     }
 
-    // Add appearance models
+    // Add the appearance property values
     if (yamlModel["AppearanceModels"]) {
         auto models = yamlModel["AppearanceModels"];
         for (auto it = models.begin(); it != models.end(); it++) {
             auto modelName = (it->first).as<std::string>();
 
-            // Add the model uuid
-            auto modelNode = models[modelName];
-            auto modelUUID = modelNode["UUID"].as<std::string>();
-            finalModel->addAppearance(QString::fromStdString(modelUUID));
-
-            // Add the property values
             auto properties = yamlModel["AppearanceModels"][modelName];
             for (auto itp = properties.begin(); itp != properties.end(); itp++) {
                 auto propertyName = (itp->first).as<std::string>();
-                if (finalModel->hasAppearanceProperty(QString::fromStdString(propertyName))) {
+                if (finalModel.hasAppearanceProperty(QString::fromStdString(propertyName))) {
                     auto prop =
-                        finalModel->getAppearanceProperty(QString::fromStdString(propertyName));
+                        finalModel.getAppearanceProperty(QString::fromStdString(propertyName));
                     auto type = prop->getType();
 
                     try {
                         if (type == MaterialValue::List || type == MaterialValue::FileList) {
                             auto list = readList(itp->second);
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
-                                                           list);
+                            finalModel.setAppearanceValue(QString::fromStdString(propertyName),
+                                                          list);
                         }
                         else if (type == MaterialValue::ImageList) {
                             auto list = readImageList(itp->second);
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
-                                                           list);
+                            finalModel.setAppearanceValue(QString::fromStdString(propertyName),
+                                                          list);
                         }
                         else if (type == MaterialValue::Array2D) {
                             auto array2d = read2DArray(itp->second, prop->columns());
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
-                                                           array2d);
+                            finalModel.setAppearanceValue(QString::fromStdString(propertyName),
+                                                          array2d);
                         }
                         else if (type == MaterialValue::Array3D) {
                             auto array3d = read3DArray(itp->second, prop->columns());
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
-                                                           array3d);
+                            finalModel.setAppearanceValue(QString::fromStdString(propertyName),
+                                                          array3d);
                         }
                         else {
                             QString propertyValue =
@@ -313,8 +334,8 @@ void MaterialYamlEntry::addToTree(
                                 propertyValue = propertyValue.remove(
                                     QRegularExpression(QString::fromStdString("[\r\n]")));
                             }
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
-                                                           propertyValue);
+                            finalModel.setAppearanceValue(QString::fromStdString(propertyName),
+                                                          propertyValue);
                         }
                     }
                     catch (const YAML::BadConversion& e) {
@@ -331,16 +352,10 @@ void MaterialYamlEntry::addToTree(
             }
         }
     }
-
-    QString path = QDir(directory).absolutePath();
-    (*materialMap)[uuid] = library->addMaterial(finalModel, path);
 }
 
 //===
 
-std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>>
-    MaterialLoader::_materialEntryMap = nullptr;
-
 MaterialLoader::MaterialLoader(
     const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
     const std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>>& libraryList)
@@ -481,29 +496,36 @@ void MaterialLoader::dereference(
             }
         }
 
-        // Add values
-        auto properties = parent->getPhysicalProperties();
-        for (auto& itp : properties) {
-            auto name = itp.first;
-            auto property = itp.second;
-
-            if (material->getPhysicalProperty(name)->isNull()) {
-                material->getPhysicalProperty(name)->setValue(property->getValue());
-            }
+        // Add values. Materials from the index inherit them once their own are read
+        if (!material->hasPendingProperties()) {
+            inheritValues(*material, *parent);
         }
+    }
 
-        properties = parent->getAppearanceProperties();
-        for (auto& itp : properties) {
-            auto name = itp.first;
-            auto property = itp.second;
+    material->markDereferenced();
+}
 
-            if (material->getAppearanceProperty(name)->isNull()) {
-                material->getAppearanceProperty(name)->setValue(property->getValue());
-            }
+void MaterialLoader::inheritValues(Material& material, const Material& parent)
+{
+    auto properties = parent.getPhysicalProperties();
+    for (auto& itp : properties) {
+        auto name = itp.first;
+        auto property = itp.second;
+
+        if (material.getPhysicalProperty(name)->isNull()) {
+            material.getPhysicalProperty(name)->setValue(property->getValue());
         }
     }
 
-    material->markDereferenced();
+    properties = parent.getAppearanceProperties();
+    for (auto& itp : properties) {
+        auto name = itp.first;
+        auto property = itp.second;
+
+        if (material.getAppearanceProperty(name)->isNull()) {
+            material.getAppearanceProperty(name)->setValue(property->getValue());
+        }
+    }
 }
 
 void MaterialLoader::dereference(const std::shared_ptr<Material>& material)
@@ -511,11 +533,69 @@ void MaterialLoader::dereference(const std::shared_ptr<Material>& material)
     dereference(_materialMap, material);
 }
 
-void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibrary>& library)
+void MaterialLoader::addIndexedMaterial(const std::shared_ptr<MaterialLibrary>& library,
+                                        const MaterialIndexEntry& entry)
 {
-    if (_materialEntryMap == nullptr) {
-        _materialEntryMap = std::make_unique<std::map<QString, std::shared_ptr<MaterialEntry>>>();
+    // Always get the name from the filename
+    QFileInfo filepath(entry.path);
+    QString name =
+        filepath.fileName().remove(QString::fromStdString(".FCMat"), Qt::CaseInsensitive);
+
+    auto material = std::make_shared<Material>(library, entry.path, entry.uuid, name);
+    material->setAuthor(entry.author);
+    material->setLicense(entry.license);
+    material->setDescription(entry.description);
+    if (!entry.parentUuid.isEmpty()) {
+        material->setParentUUID(entry.parentUuid);
+    }
+    for (auto& model : entry.physicalModels) {
+        material->addPhysical(model);
     }
+    for (auto& model : entry.appearanceModels) {
+        material->addAppearance(model);
+    }
+    material->setPropertyLoader(getPropertyLoader(entry.path));
+
+    QString path = QDir(entry.path).absolutePath();
+    (*_materialMap)[entry.uuid] = library->addMaterial(material, path);
+}
+
+std::function<void(Material&)> MaterialLoader::getPropertyLoader(const QString& path) const
+{
+    std::weak_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap = _materialMap;
+    return [path, materialMap](Material& material) {
+        std::string pathName = path.toStdString();
+        Base::FileInfo info(pathName);
+        Base::ifstream fin(info);
+        if (!fin) {
+            Base::Console().Error("YAML file open error: '%s'\n", pathName.c_str());
+            return;
+        }
+
+        try {
+            YAML::Node yamlroot = YAML::Load(fin);
+            MaterialYamlEntry::readProperties(material, yamlroot);
+        }
+        catch (YAML::Exception const& e) {
+            Base::Console().Error("YAML parsing error: '%s'\n", pathName.c_str());
+            Base::Console().Error("\t'%s'\n", e.what());
+        }
+
+        auto parentUUID = material.getParentUUID();
+        auto map = materialMap.lock();
+        if (map && parentUUID.size() > 0) {
+            auto parent = map->find(parentUUID);
+            if (parent != map->end()) {
+                inheritValues(material, *parent->second);
+            }
+        }
+    };
+}
+
+void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibrary>& library,
+                                 MaterialIndex& index)
+{
+    std::map<QString, std::shared_ptr<MaterialEntry>> materialEntryMap;
 
     QDirIterator it(library->getDirectory(), QDirIterator::Subdirectories);
     while (it.hasNext()) {
@@ -523,10 +603,17 @@ void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibrary>& library
         QFileInfo file(pathname);
         if (file.isFile()) {
             if (file.suffix().toStdString() == "FCMat") {
+                // Cards that haven't changed since they were indexed are read when used
+                auto entry = index.find(file);
+                if (entry) {
+                    addIndexedMaterial(library, *entry);
+                    continue;
+                }
+
                 try {
                     auto model = getMaterialFromPath(library, file.canonicalFilePath());
                     if (model) {
-                        (*_materialEntryMap)[model->getUUID()] = model;
+                        materialEntryMap[model->getUUID()] = model;
                     }
                 }
                 catch (const MaterialReadError&) {
@@ -536,20 +623,42 @@ void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibrary>& library
         }
     }
 
-    for (auto& it : *_materialEntryMap) {
+    for (auto& it : materialEntryMap) {
         it.second->addToTree(_materialMap);
+
+        // Index the card before the inherited models are added
+        auto material = _materialMap->at(it.first);
+        QFileInfo file(it.second->getDirectory());
+        MaterialIndexEntry entry;
+        entry.path = file.canonicalFilePath();
+        entry.modified = file.lastModified().toMSecsSinceEpoch();
+        entry.size = file.size();
+        entry.uuid = material->getUUID();
+        entry.parentUuid = material->getParentUUID();
+        entry.author = material->getAuthor();
+        entry.license = material->getLicense();
+        entry.description = material->getDescription();
+        entry.physicalModels = material->getPhysicalModels()->values();
+        entry.appearanceModels = material->getAppearanceModels()->values();
+        index.update(entry);
     }
 }
 
 void MaterialLoader::loadLibraries()
 {
+    MaterialIndex index;
+
     auto _libraryList = getMaterialLibraries();
     if (_libraryList) {
         for (auto& it : *_libraryList) {
-            loadLibrary(it);
+            loadLibrary(it, index);
         }
     }
 
+    // Only the cards that were added or changed have been read, write them back for the
+    // next start
+    index.save();
+
     for (auto& it : *_materialMap) {
         dereference(it.second);
     }
@@ -22,12 +22,14 @@
 #ifndef MATERIAL_MATERIALLOADER_H
 #define MATERIAL_MATERIALLOADER_H
 
+#include <functional>
 #include <memory>
 
 #include <QDir>
 #include <QString>
 #include <yaml-cpp/yaml.h>
 
+#include "MaterialIndex.h"
 #include "Materials.h"
 #include "trim.h"
 
@@ -93,6 +95,11 @@ public:
         return &_model;
     }
 
+    /*
+     * Set the property values of a material whose models have been added
+     */
+    static void readProperties(Material& finalModel, const YAML::Node& yamlModel);
+
 private:
     MaterialYamlEntry();
 
@@ -130,13 +137,16 @@ private:
 
     void addToTree(std::shared_ptr<MaterialEntry> model);
     void dereference(const std::shared_ptr<Material>& material);
+    static void inheritValues(Material& material, const Material& parent);
     std::shared_ptr<MaterialEntry>
     getMaterialFromPath(const std::shared_ptr<MaterialLibrary>& library, const QString& path) const;
+    void addIndexedMaterial(const std::shared_ptr<MaterialLibrary>& library,
+                            const MaterialIndexEntry& entry);
+    std::function<void(Material&)> getPropertyLoader(const QString& path) const;
     void addLibrary(const std::shared_ptr<MaterialLibrary>& model);
-    void loadLibrary(const std::shared_ptr<MaterialLibrary>& library);
+    void loadLibrary(const std::shared_ptr<MaterialLibrary>& library, MaterialIndex& index);
     void loadLibraries();
 
-    static std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>> _materialEntryMap;
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> _materialMap;
     std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>> _libraryList;
 };
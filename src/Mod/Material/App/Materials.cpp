@@ -487,6 +487,7 @@ Material::Material(const Material& other)
     , _dereferenced(other._dereferenced)
     , _oldFormat(other._oldFormat)
     , _editState(other._editState)
+    , _propertyLoader(other._propertyLoader)
 {
     for (auto& it : other._tags) {
         _tags.insert(it);
@@ -531,6 +532,20 @@ QString Material::getAuthorAndLicense() const
     return _license;
 }
 
+void Material::loadProperties() const
+{
+    if (_propertyLoader) {
+        // The loader sets the values through the regular interface, so it has to be
+        // cleared before it's called. Reading the values is not an edit.
+        auto loader = std::move(_propertyLoader);
+        _propertyLoader = nullptr;
+        auto& material = const_cast<Material&>(*this);  // NOLINT
+        ModelEdit editState = _editState;
+        loader(material);
+        material._editState = editState;
+    }
+}
+
 void Material::addModel(const QString& uuid)
 {
     for (const auto& modelUUID : std::as_const(_allUuids)) {
@@ -561,6 +576,7 @@ void Material::clearModels()
     _allUuids.clear();
     _physical.clear();
     _appearance.clear();
+    _propertyLoader = nullptr;
 }
 
 void Material::clearInherited()
@@ -822,6 +838,8 @@ void Material::setAppearanceEditState(const QString& name)
 
 void Material::setPhysicalValue(const QString& name, const QString& value)
 {
+    loadProperties();
+
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -831,6 +849,8 @@ void Material::setPhysicalValue(const QString& name, const QString& value)
 
 void Material::setPhysicalValue(const QString& name, int value)
 {
+    loadProperties();
+
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -840,6 +860,8 @@ void Material::setPhysicalValue(const QString& name, int value)
 
 void Material::setPhysicalValue(const QString& name, double value)
 {
+    loadProperties();
+
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -849,6 +871,8 @@ void Material::setPhysicalValue(const QString& name, double value)
 
 void Material::setPhysicalValue(const QString& name, const Base::Quantity& value)
 {
+    loadProperties();
+
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -858,6 +882,8 @@ void Material::setPhysicalValue(const QString& name, const Base::Quantity& value
 
 void Material::setPhysicalValue(const QString& name, const std::shared_ptr<MaterialValue>& value)
 {
+    loadProperties();
+
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -867,6 +893,8 @@ void Material::setPhysicalValue(const QString& name, const std::shared_ptr<Mater
 
 void Material::setPhysicalValue(const QString& name, const std::shared_ptr<QList<QVariant>>& value)
 {
+    loadProperties();
+
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -876,6 +904,8 @@ void Material::setPhysicalValue(const QString& name, const std::shared_ptr<QList
 
 void Material::setPhysicalValue(const QString& name, const QVariant& value)
 {
+    loadProperties();
+
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -885,6 +915,8 @@ void Material::setPhysicalValue(const QString& name, const QVariant& value)
 
 void Material::setAppearanceValue(const QString& name, const QString& value)
 {
+    loadProperties();
+
     setAppearanceEditState(name);
 
     if (hasAppearanceProperty(name)) {
@@ -894,6 +926,8 @@ void Material::setAppearanceValue(const QString& name, const QString& value)
 
 void Material::setAppearanceValue(const QString& name, const std::shared_ptr<MaterialValue>& value)
 {
+    loadProperties();
+
     setAppearanceEditState(name);
 
     if (hasAppearanceProperty(name)) {
@@ -904,6 +938,8 @@ void Material::setAppearanceValue(const QString& name, const std::shared_ptr<Mat
 void Material::setAppearanceValue(const QString& name,
                                   const std::shared_ptr<QList<QVariant>>& value)
 {
+    loadProperties();
+
     setAppearanceEditState(name);
 
     if (hasAppearanceProperty(name)) {
@@ -913,6 +949,8 @@ void Material::setAppearanceValue(const QString& name,
 
 void Material::setAppearanceValue(const QString& name, const QVariant& value)
 {
+    loadProperties();
+
     setAppearanceEditState(name);
 
     if (hasAppearanceProperty(name)) {
@@ -952,6 +990,8 @@ void Material::setLegacyValue(const QString& name, const QString& value)
 
 std::shared_ptr<MaterialProperty> Material::getPhysicalProperty(const QString& name)
 {
+    loadProperties();
+
     try {
         return _physical.at(name);
     }
@@ -962,6 +1002,8 @@ std::shared_ptr<MaterialProperty> Material::getPhysicalProperty(const QString& n
 
 std::shared_ptr<MaterialProperty> Material::getPhysicalProperty(const QString& name) const
 {
+    loadProperties();
+
     try {
         return _physical.at(name);
     }
@@ -972,6 +1014,8 @@ std::shared_ptr<MaterialProperty> Material::getPhysicalProperty(const QString& n
 
 std::shared_ptr<MaterialProperty> Material::getAppearanceProperty(const QString& name)
 {
+    loadProperties();
+
     try {
         return _appearance.at(name);
     }
@@ -982,6 +1026,8 @@ std::shared_ptr<MaterialProperty> Material::getAppearanceProperty(const QString&
 
 std::shared_ptr<MaterialProperty> Material::getAppearanceProperty(const QString& name) const
 {
+    loadProperties();
+
     try {
         return _appearance.at(name);
     }
@@ -1057,31 +1103,37 @@ Material::getValueString(const std::map<QString, std::shared_ptr<MaterialPropert
 
 QVariant Material::getPhysicalValue(const QString& name) const
 {
+    loadProperties();
     return getValue(_physical, name);
 }
 
 Base::Quantity Material::getPhysicalQuantity(const QString& name) const
 {
+    loadProperties();
     return getValue(_physical, name).value<Base::Quantity>();
 }
 
 QString Material::getPhysicalValueString(const QString& name) const
 {
+    loadProperties();
     return getValueString(_physical, name);
 }
 
 QVariant Material::getAppearanceValue(const QString& name) const
 {
+    loadProperties();
     return getValue(_appearance, name);
 }
 
 Base::Quantity Material::getAppearanceQuantity(const QString& name) const
 {
+    loadProperties();
     return getValue(_appearance, name).value<Base::Quantity>();
 }
 
 QString Material::getAppearanceValueString(const QString& name) const
 {
+    loadProperties();
     return getValueString(_appearance, name);
 }
 
@@ -1439,6 +1491,8 @@ QString Material::getModelByName(const QString& name) const
 
 void Material::save(QTextStream& stream, bool overwrite, bool saveAsCopy, bool saveInherited)
 {
+    loadProperties();
+
     if (saveInherited && !saveAsCopy) {
         // Check to see if we're an original or if we're already in the list of
         // models
@@ -1505,6 +1559,7 @@ Material& Material::operator=(const Material& other)
     _dereferenced = other._dereferenced;
     _oldFormat = other._oldFormat;
     _editState = other._editState;
+    _propertyLoader = other._propertyLoader;
 
     _tags.clear();
     for (auto& it : other._tags) {
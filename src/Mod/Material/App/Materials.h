@@ -22,6 +22,7 @@
 #ifndef MATERIAL_MATERIALS_H
 #define MATERIAL_MATERIALS_H
 
+#include <functional>
 #include <memory>
 
 #include <QDir>
@@ -347,18 +348,22 @@ public:
 
     std::map<QString, std::shared_ptr<MaterialProperty>>& getPhysicalProperties()
     {
+        loadProperties();
         return _physical;
     }
     const std::map<QString, std::shared_ptr<MaterialProperty>>& getPhysicalProperties() const
     {
+        loadProperties();
         return _physical;
     }
     std::map<QString, std::shared_ptr<MaterialProperty>>& getAppearanceProperties()
     {
+        loadProperties();
         return _appearance;
     }
     const std::map<QString, std::shared_ptr<MaterialProperty>>& getAppearanceProperties() const
     {
+        loadProperties();
         return _appearance;
     }
     std::map<QString, QString>& getLegacyProperties()
@@ -389,6 +394,20 @@ public:
         _oldFormat = isOld;
     }
 
+    /*
+     * Materials created from the library index have their models but not their property
+     * values. The loader is called to set the values the first time they are accessed.
+     */
+    void setPropertyLoader(const std::function<void(Material&)>& loader)
+    {
+        _propertyLoader = loader;
+    }
+    bool hasPendingProperties() const
+    {
+        return static_cast<bool>(_propertyLoader);
+    }
+    void loadProperties() const;
+
     /*
      * Normalize models by removing any inherited models
      */
@@ -473,6 +492,7 @@ private:
     bool _dereferenced;
     bool _oldFormat;
     ModelEdit _editState;
+    mutable std::function<void(Material&)> _propertyLoader;
 };
 
 inline QTextStream& operator<<(QTextStream& output, const MaterialProperty& property)
@@ -57,17 +57,24 @@
 
 // Qt
 #include <QtGlobal>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
 #include <QDirIterator>
+#include <QFile>
 #include <QFileInfo>
+#include <QFuture>
 #include <QIODevice>
 #include <QList>
 #include <QMetaType>
 #include <QMetaType>
 #include <QRegularExpression>
+#include <QSaveFile>
 #include <QString>
 #include <QTextStream>
 #include <QUuid>
 #include <QVector>
+#include <QtConcurrentRun>
 
 #endif  //_PreComp_
 
@@ -271,6 +271,9 @@ private:
                                                      Extension3MFFactory::createExtensions());
             dynamic_cast<Exporter3MF*>(exporter.get())->setForceModel(export3mfModel);
         }
+        else if (exportFormat == MeshIO::GLTF) {
+            exporter = std::make_unique<ExporterGLTF>(outputFileName);
+        }
         else if (exportFormat != MeshIO::Undefined) {
             exporter = std::make_unique<MergeExporter>(outputFileName, exportFormat);
         }
@@ -0,0 +1,422 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <numeric>
+#include <set>
+#endif
+
+#include "Core/Degeneration.h"
+#include "Core/MeshIO.h"
+#include "Core/MeshKernel.h"
+#include <Base/Base64.h>
+#include <Base/Converter.h>
+#include <Base/FileInfo.h>
+#include <Base/Rotation.h>
+#include <Base/Stream.h>
+
+#include "ReaderGLTF.h"
+#include "json.hpp"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+const int ComponentByte = 5120;
+const int ComponentUnsignedByte = 5121;
+const int ComponentShort = 5122;
+const int ComponentUnsignedShort = 5123;
+const int ComponentUnsignedInt = 5125;
+const int ComponentFloat = 5126;
+const int ModeTriangles = 4;
+
+const uint32_t GlbMagic = 0x46546C67;
+const uint32_t ChunkJson = 0x4E4F534A;
+const uint32_t ChunkBin = 0x004E4942;
+
+uint32_t readUInt32(const std::string& data, std::size_t pos)
+{
+    auto byte = [&data, pos](std::size_t i) {
+        return static_cast<uint32_t>(static_cast<unsigned char>(data[pos + i]));
+    };
+    return byte(0) | (byte(1) << 8) | (byte(2) << 16) | (byte(3) << 24);
+}
+
+int componentSize(int type)
+{
+    switch (type) {
+        case ComponentByte:
+        case ComponentUnsignedByte:
+            return 1;
+        case ComponentShort:
+        case ComponentUnsignedShort:
+            return 2;
+        case ComponentUnsignedInt:
+        case ComponentFloat:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+/// Reads a little-endian component, normalized integers are mapped to [-1,1] or [0,1]
+double readComponent(const char* ptr, int type, bool normalized)
+{
+    auto byte = [ptr](int i) {
+        return static_cast<uint32_t>(static_cast<unsigned char>(ptr[i]));
+    };
+    switch (type) {
+        case ComponentByte: {
+            auto value = static_cast<int8_t>(byte(0));
+            return normalized ? std::max(value / 127.0, -1.0) : value;
+        }
+        case ComponentUnsignedByte:
+            return normalized ? byte(0) / 255.0 : byte(0);
+        case ComponentShort: {
+            auto value = static_cast<int16_t>(byte(0) | (byte(1) << 8));
+            return normalized ? std::max(value / 32767.0, -1.0) : value;
+        }
+        case ComponentUnsignedShort: {
+            uint32_t value = byte(0) | (byte(1) << 8);
+            return normalized ? value / 65535.0 : value;
+        }
+        case ComponentUnsignedInt:
+            return byte(0) | (byte(1) << 8) | (byte(2) << 16) | (byte(3) << 24);
+        case ComponentFloat: {
+            uint32_t bits = byte(0) | (byte(1) << 8) | (byte(2) << 16) | (byte(3) << 24);
+            float value {};
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        default:
+            return 0.0;
+    }
+}
+// NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+
+class GltfDocument
+{
+public:
+    GltfDocument(nlohmann::json gltf, std::vector<std::string> buffers)
+        : gltf(std::move(gltf))
+        , buffers(std::move(buffers))
+    {
+        // make sure that the top-level arrays exist to access them without copies
+        for (const char* key : {"nodes", "meshes", "accessors", "bufferViews"}) {
+            if (!this->gltf.contains(key) || !this->gltf[key].is_array()) {
+                this->gltf[key] = nlohmann::json::array();
+            }
+        }
+    }
+
+    void readScene(const Base::Matrix4D& mat, MeshPointArray& points, MeshFacetArray& facets)
+    {
+        const auto& nodes = gltf.at("nodes");
+        std::vector<std::size_t> roots;
+        if (gltf.contains("scenes") && !gltf["scenes"].empty()) {
+            const auto& scenes = gltf["scenes"];
+            std::size_t scene = std::min(gltf.value("scene", std::size_t(0)), scenes.size() - 1);
+            for (const auto& it : scenes[scene].value("nodes", nlohmann::json::array())) {
+                roots.push_back(it.get<std::size_t>());
+            }
+        }
+        else {
+            // without a scene take all nodes that are not children of another one
+            std::vector<bool> isChild(nodes.size(), false);
+            for (const auto& node : nodes) {
+                for (const auto& it : node.value("children", nlohmann::json::array())) {
+                    std::size_t child = it.get<std::size_t>();
+                    if (child < isChild.size()) {
+                        isChild[child] = true;
+                    }
+                }
+            }
+            for (std::size_t i = 0; i < nodes.size(); i++) {
+                if (!isChild[i]) {
+                    roots.push_back(i);
+                }
+            }
+        }
+
+        for (std::size_t root : roots) {
+            readNode(root, mat, points, facets);
+        }
+    }
+
+private:
+    void readNode(std::size_t index,
+                  const Base::Matrix4D& parent,
+                  MeshPointArray& points,
+                  MeshFacetArray& facets)
+    {
+        const auto& nodes = gltf.at("nodes");
+        // nodes must form disjoint trees, ignore broken files with cycles
+        if (index >= nodes.size() || !visited.insert(index).second) {
+            return;
+        }
+
+        const auto& node = nodes[index];
+        Base::Matrix4D mat = parent * nodeTransform(node);
+        if (node.contains("mesh")) {
+            readMesh(node["mesh"].get<std::size_t>(), mat, points, facets);
+        }
+        for (const auto& it : node.value("children", nlohmann::json::array())) {
+            readNode(it.get<std::size_t>(), mat, points, facets);
+        }
+    }
+
+    static Base::Matrix4D nodeTransform(const nlohmann::json& node)
+    {
+        Base::Matrix4D mat;
+        if (node.contains("matrix")) {
+            auto values = node["matrix"].get<std::vector<double>>();
+            if (values.size() == 16) {  // NOLINT
+                mat.setGLMatrix(values.data());
+            }
+            return mat;
+        }
+
+        if (node.contains("scale")) {
+            auto scale = node["scale"].get<std::vector<double>>();
+            if (scale.size() == 3) {
+                mat.scale(scale[0], scale[1], scale[2]);
+            }
+        }
+        if (node.contains("rotation")) {
+            auto quat = node["rotation"].get<std::vector<double>>();
+            if (quat.size() == 4) {
+                Base::Matrix4D rot;
+                Base::Rotation(quat[0], quat[1], quat[2], quat[3]).getValue(rot);
+                mat = rot * mat;
+            }
+        }
+        if (node.contains("translation")) {
+            auto move = node["translation"].get<std::vector<double>>();
+            if (move.size() == 3) {
+                mat.move(move[0], move[1], move[2]);
+            }
+        }
+        return mat;
+    }
+
+    void readMesh(std::size_t index,
+                  const Base::Matrix4D& mat,
+                  MeshPointArray& points,
+                  MeshFacetArray& facets)
+    {
+        const auto& meshes = gltf.at("meshes");
+        if (index >= meshes.size()) {
+            return;
+        }
+
+        for (const auto& prim : meshes[index].value("primitives", nlohmann::json::array())) {
+            if (prim.value("mode", ModeTriangles) != ModeTriangles) {
+                continue;
+            }
+            const auto& attributes = prim.value("attributes", nlohmann::json::object());
+            if (!attributes.contains("POSITION")) {
+                continue;
+            }
+
+            std::vector<double> coords;
+            readAccessor(attributes["POSITION"].get<std::size_t>(), 3, coords);
+            std::size_t countPoints = coords.size() / 3;
+            std::vector<double> indices;
+            if (prim.contains("indices")) {
+                readAccessor(prim["indices"].get<std::size_t>(), 1, indices);
+            }
+            else {
+                indices.resize(countPoints);
+                std::iota(indices.begin(), indices.end(), 0.0);
+            }
+
+            auto offset = static_cast<PointIndex>(points.size());
+            for (std::size_t i = 0; i < countPoints; i++) {
+                Base::Vector3d pnt(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
+                points.push_back(Base::convertTo<Base::Vector3f>(mat * pnt));
+            }
+            for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+                auto i1 = static_cast<PointIndex>(indices[i]);
+                auto i2 = static_cast<PointIndex>(indices[i + 1]);
+                auto i3 = static_cast<PointIndex>(indices[i + 2]);
+                if (i1 < countPoints && i2 < countPoints && i3 < countPoints) {
+                    facets.push_back(MeshFacet(offset + i1, offset + i2, offset + i3));
+                }
+            }
+        }
+    }
+
+    void readAccessor(std::size_t index, std::size_t components, std::vector<double>& values) const
+    {
+        const auto& accessors = gltf.at("accessors");
+        if (index >= accessors.size()) {
+            return;
+        }
+
+        values.clear();
+        const auto& accessor = accessors[index];
+        std::size_t count = accessor.value("count", std::size_t(0));
+        int type = accessor.value("componentType", 0);
+        bool normalized = accessor.value("normalized", false);
+        int size = componentSize(type);
+        // Accessors without buffer view would be all zeros, which give no usable geometry. Their
+        // count is not backed by any data, so it is not used for an allocation.
+        if (count == 0 || size == 0 || !accessor.contains("bufferView")) {
+            return;
+        }
+
+        const auto& views = gltf.at("bufferViews");
+        std::size_t viewIndex = accessor["bufferView"].get<std::size_t>();
+        if (viewIndex >= views.size()) {
+            return;
+        }
+        const auto& view = views[viewIndex];
+        std::size_t bufferIndex = view.value("buffer", std::size_t(0));
+        if (bufferIndex >= buffers.size()) {
+            return;
+        }
+
+        // All numbers come from the file, so check the range of the accessed bytes without
+        // any arithmetic that may overflow.
+        const std::string& buffer = buffers[bufferIndex];
+        std::size_t viewOffset = view.value("byteOffset", std::size_t(0));
+        std::size_t accessorOffset = accessor.value("byteOffset", std::size_t(0));
+        std::size_t element = components * size;
+        std::size_t stride = view.value("byteStride", element);
+        if (stride < element || viewOffset > buffer.size()
+            || accessorOffset > buffer.size() - viewOffset) {
+            return;
+        }
+        std::size_t start = viewOffset + accessorOffset;
+        if (element > buffer.size() - start
+            || count > (buffer.size() - start - element) / stride + 1) {
+            return;
+        }
+
+        values.assign(count * components, 0.0);
+        for (std::size_t i = 0; i < count; i++) {
+            const char* ptr = buffer.data() + start + i * stride;
+            for (std::size_t j = 0; j < components; j++) {
+                values[i * components + j] = readComponent(ptr + j * size, type, normalized);
+            }
+        }
+    }
+
+private:
+    nlohmann::json gltf;
+    std::vector<std::string> buffers;
+    std::set<std::size_t> visited;
+};
+}  // namespace
+
+ReaderGLTF::ReaderGLTF(MeshKernel& kernel)
+    : _kernel(kernel)
+{}
+
+bool ReaderGLTF::Load(std::istream& input, const std::string& dirPath)
+{
+    if (!input || input.bad()) {
+        return false;
+    }
+
+    std::string data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    std::string text;
+    std::string binChunk;
+    // NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+    if (data.size() >= 12 && readUInt32(data, 0) == GlbMagic) {
+        std::size_t length = std::min<std::size_t>(readUInt32(data, 8), data.size());
+        std::size_t pos = 12;
+        while (pos + 8 <= length) {
+            std::size_t chunkLength = readUInt32(data, pos);
+            uint32_t chunkType = readUInt32(data, pos + 4);
+            pos += 8;
+            if (pos + chunkLength > length) {
+                return false;
+            }
+            if (chunkType == ChunkJson) {
+                text = data.substr(pos, chunkLength);
+            }
+            else if (chunkType == ChunkBin && binChunk.empty()) {
+                binChunk = data.substr(pos, chunkLength);
+            }
+            pos += chunkLength;
+        }
+    }
+    else {
+        text.swap(data);
+    }
+    // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+
+    nlohmann::json gltf = nlohmann::json::parse(text, nullptr, false);
+    if (gltf.is_discarded() || !gltf.is_object()) {
+        return false;
+    }
+
+    std::vector<std::string> buffers;
+    for (const auto& it : gltf.value("buffers", nlohmann::json::array())) {
+        std::string uri = it.value("uri", std::string());
+        if (uri.empty()) {
+            buffers.push_back(binChunk);
+        }
+        else if (uri.compare(0, 5, "data:") == 0) {  // NOLINT
+            std::size_t pos = uri.find(',');
+            buffers.push_back(pos == std::string::npos ? std::string()
+                                                       : Base::base64_decode(uri.substr(pos + 1)));
+        }
+        else {
+            Base::FileInfo fi(dirPath.empty() ? uri : dirPath + "/" + uri);
+            Base::ifstream str(fi, std::ios::in | std::ios::binary);
+            buffers.emplace_back((std::istreambuf_iterator<char>(str)),
+                                 std::istreambuf_iterator<char>());
+        }
+    }
+
+    // glTF uses meters and the y-axis pointing up
+    const double millimeter = 1000.0;
+    Base::Matrix4D mat(millimeter, 0, 0, 0, 0, 0, -millimeter, 0, 0, millimeter, 0, 0, 0, 0, 0, 1);
+
+    MeshPointArray meshPoints;
+    MeshFacetArray meshFacets;
+    GltfDocument doc(std::move(gltf), std::move(buffers));
+    doc.readScene(mat, meshPoints, meshFacets);
+
+    MeshCleanup meshCleanup(meshPoints, meshFacets);
+    meshCleanup.RemoveInvalids();
+    MeshPointFacetAdjacency meshAdj(meshPoints.size(), meshFacets);
+    meshAdj.SetFacetNeighbourhood();
+    _kernel.Adopt(meshPoints, meshFacets);
+
+    // vertices are split where the normals differ
+    if (!MeshEvalDuplicatePoints(_kernel).Evaluate()) {
+        MeshFixDuplicatePoints(_kernel).Fixup();
+    }
+
+    return true;
+}
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_IO_READER_GLTF_H
+#define MESH_IO_READER_GLTF_H
+
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/MeshGlobal.h>
+#include <iosfwd>
+#include <string>
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/** Loads the mesh object from data in glTF 2.0 format.
+ *
+ * Binary .glb data and .gltf files with embedded or external buffers are supported. The triangles
+ * of all mesh instances of the default scene are merged into one mesh. Quantized attributes as
+ * defined by KHR_mesh_quantization are accepted.
+ */
+class MeshExport ReaderGLTF
+{
+public:
+    /*!
+     * \brief ReaderGLTF
+     */
+    explicit ReaderGLTF(MeshKernel& kernel);
+    /*!
+     * \brief Load the mesh from the input stream
+     * \param input The input stream
+     * \param dirPath The directory to resolve relative paths of external buffers
+     * \return true on success and false otherwise
+     */
+    bool Load(std::istream& input, const std::string& dirPath = {});
+
+private:
+    MeshKernel& _kernel;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_IO_READER_GLTF_H
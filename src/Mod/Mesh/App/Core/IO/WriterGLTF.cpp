@@ -0,0 +1,454 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <ostream>
+#endif
+
+#include <QtConcurrentMap>
+
+#include "Core/MeshKernel.h"
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+#include <Base/Tools.h>
+
+#include "WriterGLTF.h"
+#include "json.hpp"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+// component types and buffer targets of the glTF specification
+const int ComponentByte = 5120;
+const int ComponentUnsignedShort = 5123;
+const int ComponentUnsignedInt = 5125;
+const int TargetArrayBuffer = 34962;
+const int TargetElementArrayBuffer = 34963;
+const int ModeTriangles = 4;
+
+const uint32_t GlbMagic = 0x46546C67;
+const uint32_t GlbVersion = 2;
+const uint32_t ChunkJson = 0x4E4F534A;
+const uint32_t ChunkBin = 0x004E4942;
+
+const double QuantizationSteps = 65535.0;
+const float NormalScale = 127.0F;
+// vertices of adjacent facets share their normal if the facets don't enclose a larger angle
+const float CreaseAngle = 45.0F;
+
+// vertex attributes must be aligned to four bytes, so positions get one and normals one
+// byte of padding
+const std::size_t PositionStride = 8;
+const std::size_t NormalStride = 4;
+// NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+
+std::size_t align4(std::size_t size)
+{
+    return (size + 3) & ~std::size_t(3);
+}
+
+bool useShortIndices(std::size_t countVertices)
+{
+    // the maximum value of the component type is reserved for primitive restart
+    return countVertices < std::numeric_limits<uint16_t>::max();
+}
+
+std::size_t indexSize(std::size_t countVertices)
+{
+    return useShortIndices(countVertices) ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+std::vector<double> glMatrix(const Base::Matrix4D& mat)
+{
+    std::vector<double> values(16);  // NOLINT
+    mat.getGLMatrix(values.data());
+    return values;
+}
+}  // namespace
+
+WriterGLTF::WriterGLTF(std::ostream& str)
+    : output(&str)
+{}
+
+WriterGLTF::WriterGLTF(std::ostream& str, const std::string& filename)
+    : output(&str)
+    , filename(filename)
+{}
+
+WriterGLTF::WriterGLTF(const std::string& filename)
+    : filename(filename)
+{}
+
+bool WriterGLTF::AddMesh(const MeshKernel& mesh, const Base::Matrix4D& mat, const std::string& name)
+{
+    if (mesh.CountFacets() == 0) {
+        return false;
+    }
+
+    auto it = std::find_if(meshes.begin(), meshes.end(), [&mesh](const Primitive& prim) {
+        return prim.kernel == &mesh;
+    });
+    Instance inst;
+    inst.mesh = std::distance(meshes.begin(), it);
+    inst.transform = mat;
+    inst.name = name;
+    if (it == meshes.end()) {
+        Primitive prim;
+        prim.kernel = &mesh;
+        meshes.push_back(prim);
+    }
+
+    instances.push_back(inst);
+    return true;
+}
+
+bool WriterGLTF::Save()
+{
+    QtConcurrent::blockingMap(meshes, &WriterGLTF::Quantize);
+
+    if (output) {
+        return SaveStream(*output);
+    }
+
+    Base::FileInfo fi(filename);
+    Base::ofstream str(fi, std::ios::out | std::ios::binary);
+    return SaveStream(str);
+}
+
+bool WriterGLTF::SaveStream(std::ostream& str)
+{
+    Base::FileInfo fi(filename);
+    if (!fi.hasExtension("gltf")) {
+        return SaveBinary(str);
+    }
+
+    std::string binName = fi.fileNamePure() + ".bin";
+    Base::FileInfo bin(fi.dirPath() + "/" + binName);
+    Base::ofstream binStr(bin, std::ios::out | std::ios::binary);
+    for (const auto& it : meshes) {
+        WriteBinary(binStr, it);
+    }
+    if (!binStr) {
+        return false;
+    }
+
+    return SaveText(str, binName);
+}
+
+void WriterGLTF::Quantize(Primitive& prim)
+{
+    const MeshKernel& mesh = *prim.kernel;
+    const MeshPointArray& points = mesh.GetPoints();
+    const MeshFacetArray& facets = mesh.GetFacets();
+    std::size_t countPoints = points.size();
+    std::size_t countFacets = facets.size();
+
+    // area weighted facet normals
+    std::vector<Base::Vector3f> normals(countFacets);
+    std::vector<Base::Vector3f> units(countFacets);
+    for (std::size_t i = 0; i < countFacets; i++) {
+        const MeshFacet& face = facets[i];
+        const Base::Vector3f& p0 = points[face._aulPoints[0]];
+        normals[i] = (points[face._aulPoints[1]] - p0) % (points[face._aulPoints[2]] - p0);
+        units[i] = normals[i];
+        units[i].Normalize();
+    }
+
+    // facets around each point
+    std::vector<std::size_t> offsets(countPoints + 1, 0);
+    for (const auto& face : facets) {
+        for (PointIndex index : face._aulPoints) {
+            offsets[index + 1]++;
+        }
+    }
+    for (std::size_t i = 0; i < countPoints; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    std::vector<FacetIndex> adjacent(offsets.back());
+    std::vector<std::size_t> fill(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i < countFacets; i++) {
+        for (PointIndex index : facets[i]._aulPoints) {
+            adjacent[fill[index]++] = i;
+        }
+    }
+
+    // Each corner gets the average normal of the facets around its point that don't enclose
+    // a larger angle with its facet. The point is split for each distinct quantized normal.
+    const float minCos = std::cos(Base::toRadians(CreaseAngle));
+    prim.indices.resize(3 * countFacets);
+    prim.positions.clear();
+    prim.normals.clear();
+    const Base::BoundBox3f& box = mesh.GetBoundBox();
+    Base::Vector3f origin(box.MinX, box.MinY, box.MinZ);
+    double extent = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+    double step = extent > 0.0 ? extent / QuantizationSteps : 1.0;
+
+    std::vector<std::pair<std::array<int8_t, 3>, uint32_t>> split;
+    for (std::size_t i = 0; i < countPoints; i++) {
+        split.clear();
+        std::array<uint16_t, 3> position {};
+        Base::Vector3f local = points[i] - origin;
+        for (int j = 0; j < 3; j++) {
+            double value = std::round(local[j] / step);
+            position[j] = static_cast<uint16_t>(std::clamp(value, 0.0, QuantizationSteps));
+        }
+
+        for (std::size_t j = offsets[i]; j < offsets[i + 1]; j++) {
+            FacetIndex face = adjacent[j];
+            Base::Vector3f normal;
+            for (std::size_t k = offsets[i]; k < offsets[i + 1]; k++) {
+                if (units[adjacent[k]] * units[face] >= minCos) {
+                    normal += normals[adjacent[k]];
+                }
+            }
+            if (normal.IsNull()) {
+                // degenerated facet
+                for (std::size_t k = offsets[i]; k < offsets[i + 1]; k++) {
+                    normal += normals[adjacent[k]];
+                }
+                if (normal.IsNull()) {
+                    normal.Set(0.0F, 0.0F, 1.0F);
+                }
+            }
+            normal.Normalize();
+
+            std::array<int8_t, 3> quantized {};
+            for (int k = 0; k < 3; k++) {
+                quantized[k] = static_cast<int8_t>(std::round(normal[k] * NormalScale));
+            }
+
+            auto it = std::find_if(split.begin(), split.end(), [&quantized](const auto& value) {
+                return value.first == quantized;
+            });
+            if (it == split.end()) {
+                auto vertex = static_cast<uint32_t>(prim.positions.size() / 3);
+                it = split.emplace(split.end(), quantized, vertex);
+                prim.positions.insert(prim.positions.end(), position.begin(), position.end());
+                prim.normals.insert(prim.normals.end(), quantized.begin(), quantized.end());
+            }
+
+            for (int k = 0; k < 3; k++) {
+                if (facets[face]._aulPoints[k] == i) {
+                    prim.indices[3 * face + k] = it->second;
+                }
+            }
+        }
+    }
+
+    // the node transform maps the quantized positions back to the original ones
+    prim.dequantize = Base::Matrix4D();
+    prim.dequantize.scale(step);
+    prim.dequantize.move(Base::Vector3d(box.MinX, box.MinY, box.MinZ));
+}
+
+std::size_t WriterGLTF::ByteLength(const Primitive& prim)
+{
+    std::size_t countVertices = prim.positions.size() / 3;
+    return countVertices * (PositionStride + NormalStride)
+        + align4(prim.indices.size() * indexSize(countVertices));
+}
+
+void WriterGLTF::WriteBinary(std::ostream& str, const Primitive& prim)
+{
+    Base::OutputStream out(str);
+    out.setByteOrder(Base::Stream::LittleEndian);
+
+    std::size_t countVertices = prim.positions.size() / 3;
+    for (std::size_t i = 0; i < countVertices; i++) {
+        out << prim.positions[3 * i] << prim.positions[3 * i + 1] << prim.positions[3 * i + 2]
+            << uint16_t(0);
+    }
+    for (std::size_t i = 0; i < countVertices; i++) {
+        out << prim.normals[3 * i] << prim.normals[3 * i + 1] << prim.normals[3 * i + 2]
+            << int8_t(0);
+    }
+    if (useShortIndices(countVertices)) {
+        for (uint32_t index : prim.indices) {
+            out << static_cast<uint16_t>(index);
+        }
+        if (prim.indices.size() % 2 != 0) {
+            out << uint16_t(0);
+        }
+    }
+    else {
+        for (uint32_t index : prim.indices) {
+            out << index;
+        }
+    }
+}
+
+std::string WriterGLTF::CreateJson(const std::string& uri) const
+{
+    using nlohmann::json;
+    json gltf;
+    gltf["asset"] = {{"version", "2.0"}, {"generator", "FreeCAD"}};
+    gltf["extensionsUsed"] = {"KHR_mesh_quantization"};
+    gltf["extensionsRequired"] = {"KHR_mesh_quantization"};
+    gltf["scene"] = 0;
+    gltf["scenes"] = json::array({{{"nodes", {0}}}});
+
+    // glTF uses meters and the y-axis pointing up
+    const double meter = 0.001;
+    Base::Matrix4D root(meter, 0, 0, 0, 0, 0, meter, 0, 0, -meter, 0, 0, 0, 0, 0, 1);
+    json rootNode = {{"matrix", glMatrix(root)}};
+    json children = json::array();
+    json nodes = json::array();
+    for (const auto& it : instances) {
+        children.push_back(nodes.size() + 1);
+        json node = {{"mesh", it.mesh},
+                     {"matrix", glMatrix(it.transform * meshes[it.mesh].dequantize)}};
+        if (!it.name.empty()) {
+            node["name"] = it.name;
+        }
+        nodes.push_back(node);
+    }
+    if (!children.empty()) {
+        rootNode["children"] = children;
+    }
+    nodes.insert(nodes.begin(), rootNode);
+    gltf["nodes"] = nodes;
+
+    if (meshes.empty()) {
+        return gltf.dump();
+    }
+
+    json gltfMeshes = json::array();
+    json accessors = json::array();
+    json bufferViews = json::array();
+    std::size_t offset = 0;
+    for (const auto& it : meshes) {
+        std::size_t countVertices = it.positions.size() / 3;
+        std::array<uint16_t, 3> minPos {};
+        std::array<uint16_t, 3> maxPos {};
+        minPos.fill(std::numeric_limits<uint16_t>::max());
+        for (std::size_t i = 0; i < it.positions.size(); i++) {
+            minPos[i % 3] = std::min(minPos[i % 3], it.positions[i]);
+            maxPos[i % 3] = std::max(maxPos[i % 3], it.positions[i]);
+        }
+
+        std::size_t view = bufferViews.size();
+        std::size_t accessor = accessors.size();
+        bufferViews.push_back({{"buffer", 0},
+                               {"byteOffset", offset},
+                               {"byteLength", countVertices * PositionStride},
+                               {"byteStride", PositionStride},
+                               {"target", TargetArrayBuffer}});
+        offset += countVertices * PositionStride;
+        bufferViews.push_back({{"buffer", 0},
+                               {"byteOffset", offset},
+                               {"byteLength", countVertices * NormalStride},
+                               {"byteStride", NormalStride},
+                               {"target", TargetArrayBuffer}});
+        offset += countVertices * NormalStride;
+        std::size_t length = it.indices.size() * indexSize(countVertices);
+        bufferViews.push_back({{"buffer", 0},
+                               {"byteOffset", offset},
+                               {"byteLength", length},
+                               {"target", TargetElementArrayBuffer}});
+        offset += align4(length);
+
+        accessors.push_back({{"bufferView", view},
+                             {"componentType", ComponentUnsignedShort},
+                             {"count", countVertices},
+                             {"type", "VEC3"},
+                             {"min", minPos},
+                             {"max", maxPos}});
+        accessors.push_back({{"bufferView", view + 1},
+                             {"componentType", ComponentByte},
+                             {"normalized", true},
+                             {"count", countVertices},
+                             {"type", "VEC3"}});
+        accessors.push_back({{"bufferView", view + 2},
+                             {"componentType",
+                              useShortIndices(countVertices) ? ComponentUnsignedShort
+                                                             : ComponentUnsignedInt},
+                             {"count", it.indices.size()},
+                             {"type", "SCALAR"}});
+
+        json primitive = {{"attributes", {{"POSITION", accessor}, {"NORMAL", accessor + 1}}},
+                          {"indices", accessor + 2},
+                          {"mode", ModeTriangles}};
+        gltfMeshes.push_back({{"primitives", {primitive}}});
+    }
+
+    json buffer = {{"byteLength", offset}};
+    if (!uri.empty()) {
+        buffer["uri"] = uri;
+    }
+    gltf["meshes"] = gltfMeshes;
+    gltf["accessors"] = accessors;
+    gltf["bufferViews"] = bufferViews;
+    gltf["buffers"] = json::array({buffer});
+    return gltf.dump();
+}
+
+bool WriterGLTF::SaveText(std::ostream& str, const std::string& binName)
+{
+    if (!str || str.bad()) {
+        return false;
+    }
+
+    str << CreateJson(binName);
+    return static_cast<bool>(str);
+}
+
+bool WriterGLTF::SaveBinary(std::ostream& str)
+{
+    if (!str || str.bad()) {
+        return false;
+    }
+
+    std::string content = CreateJson({});
+    content.resize(align4(content.size()), ' ');
+    std::size_t binLength = 0;
+    for (const auto& it : meshes) {
+        binLength += ByteLength(it);
+    }
+
+    std::size_t length = 12 + 8 + content.size();  // NOLINT
+    if (binLength > 0) {
+        length += 8 + binLength;  // NOLINT
+    }
+
+    Base::OutputStream out(str);
+    out.setByteOrder(Base::Stream::LittleEndian);
+    out << GlbMagic << GlbVersion << static_cast<uint32_t>(length);
+    out << static_cast<uint32_t>(content.size()) << ChunkJson;
+    str.write(content.data(), static_cast<std::streamsize>(content.size()));
+    if (binLength > 0) {
+        out << static_cast<uint32_t>(binLength) << ChunkBin;
+        for (const auto& it : meshes) {
+            WriteBinary(str, it);
+        }
+    }
+
+    return static_cast<bool>(str);
+}
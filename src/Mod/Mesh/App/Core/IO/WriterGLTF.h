@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_IO_WRITER_GLTF_H
+#define MESH_IO_WRITER_GLTF_H
+
+#include <Mod/Mesh/MeshGlobal.h>
+#include <Base/Matrix.h>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace MeshCore
+{
+class MeshKernel;
+
+/** Saves mesh objects into glTF 2.0 format.
+ *
+ * The vertex positions are stored as unsigned shorts and the normals as bytes as allowed
+ * by the KHR_mesh_quantization extension. The dequantization is part of the node transform,
+ * so viewers don't have to decode anything. Adding the same mesh kernel several times creates
+ * one glTF mesh that is referenced by several nodes.
+ *
+ * If written to a file with the extension .gltf the binary data goes to a .bin file next to it,
+ * otherwise a binary .glb file is written.
+ */
+class MeshExport WriterGLTF
+{
+public:
+    /*!
+     * \brief WriterGLTF
+     * Passes an output stream to the constructor. The data is written in binary format.
+     * \param str
+     */
+    explicit WriterGLTF(std::ostream& str);
+
+    /*!
+     * \brief WriterGLTF
+     * Passes an output stream and the name of the file it writes to. If the file name has
+     * the extension .gltf the stream gets the JSON data and the binary data is written
+     * to a .bin file next to it.
+     * \param str
+     * \param filename
+     */
+    WriterGLTF(std::ostream& str, const std::string& filename);
+
+    /*!
+     * \brief WriterGLTF
+     * Passes a file name to the constructor
+     * \param filename
+     */
+    explicit WriterGLTF(const std::string& filename);
+
+    /*!
+     * \brief Add an instance of a mesh object.
+     * The mesh kernel is only referenced and must be kept alive until \ref Save is called,
+     * further instances of it are recognized by its address.
+     * \param mesh The mesh object to be written
+     * \param mat The placement of the mesh object
+     * \param name The name of the instance
+     * \return true if the mesh could be added, false otherwise.
+     */
+    bool AddMesh(const MeshKernel& mesh, const Base::Matrix4D& mat, const std::string& name = {});
+    /*!
+     * \brief Quantize the added mesh objects in parallel and write them.
+     * \return true if the data could be written successfully, false otherwise.
+     */
+    bool Save();
+
+private:
+    struct Primitive
+    {
+        const MeshKernel* kernel = nullptr;
+        std::vector<uint16_t> positions;
+        std::vector<int8_t> normals;
+        std::vector<uint32_t> indices;
+        Base::Matrix4D dequantize;
+    };
+    struct Instance
+    {
+        std::size_t mesh = 0;
+        Base::Matrix4D transform;
+        std::string name;
+    };
+
+    static void Quantize(Primitive&);
+    static std::size_t ByteLength(const Primitive&);
+    std::string CreateJson(const std::string& uri) const;
+    static void WriteBinary(std::ostream& str, const Primitive&);
+    bool SaveStream(std::ostream& str);
+    bool SaveBinary(std::ostream& str);
+    bool SaveText(std::ostream& str, const std::string& binName);
+
+private:
+    std::ostream* output = nullptr;
+    std::string filename;
+    std::vector<Primitive> meshes;
+    std::vector<Instance> instances;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_IO_WRITER_GLTF_H
@@ -37,9 +37,11 @@
 #include <boost/regex.hpp>
 
 #include "IO/Reader3MF.h"
+#include "IO/ReaderGLTF.h"
 #include "IO/ReaderOBJ.h"
 #include "IO/ReaderPLY.h"
 #include "IO/Writer3MF.h"
+#include "IO/WriterGLTF.h"
 #include "IO/WriterInventor.h"
 #include "IO/WriterOBJ.h"
 #include <Base/Builder3D.h>
@@ -189,6 +191,8 @@ std::vector<std::string> MeshInput::supportedMeshFormats()
     fmt.emplace_back("bdf");
     fmt.emplace_back("off");
     fmt.emplace_back("smf");
+    fmt.emplace_back("gltf");
+    fmt.emplace_back("glb");
     return fmt;
 }
 
@@ -216,6 +220,9 @@ MeshIO::Format MeshInput::getFormat(const char* FileName)
     if (fi.hasExtension("smf")) {
         return MeshIO::Format::SMF;
     }
+    if (fi.hasExtension({"gltf", "glb"})) {
+        return MeshIO::Format::GLTF;
+    }
 
     throw Base::FileException("File extension not supported", FileName);
 }
@@ -267,6 +274,9 @@ bool MeshInput::LoadAny(const char* FileName)
             ok = Load3MF(zip.getStream());
         }
     }
+    else if (fi.hasExtension({"gltf", "glb"})) {
+        ok = LoadGLTF(str, fi.dirPath());
+    }
     else if (fi.hasExtension("off")) {
         ok = LoadOFF(str);
     }
@@ -301,6 +311,8 @@ bool MeshInput::LoadFormat(std::istream& input, MeshIO::Format fmt)
             return LoadSMF(input);
         case MeshIO::ThreeMF:
             return Load3MF(input);
+        case MeshIO::GLTF:
+            return LoadGLTF(input);
         case MeshIO::OFF:
             return LoadOFF(input);
         case MeshIO::IV:
@@ -921,6 +933,13 @@ bool MeshInput::Load3MF(std::istream& input)
     return false;
 }
 
+/** Loads a glTF file. */
+bool MeshInput::LoadGLTF(std::istream& input, const std::string& dirPath)
+{
+    ReaderGLTF reader(this->_rclMesh);
+    return reader.Load(input, dirPath);
+}
+
 /** Loads an OpenInventor file. */
 bool MeshInput::LoadInventor(std::istream& input)
 {
@@ -1296,6 +1315,8 @@ std::vector<std::string> MeshOutput::supportedMeshFormats()
     fmt.emplace_back("amf");
     fmt.emplace_back("asy");
     fmt.emplace_back("3mf");
+    fmt.emplace_back("gltf");
+    fmt.emplace_back("glb");
     return fmt;
 }
 
@@ -1356,6 +1377,9 @@ MeshIO::Format MeshOutput::GetFormat(const char* FileName)
     if (file.hasExtension("3mf")) {
         return MeshIO::ThreeMF;
     }
+    if (file.hasExtension({"gltf", "glb"})) {
+        return MeshIO::GLTF;
+    }
     if (file.hasExtension("smf")) {
         return MeshIO::SMF;
     }
@@ -1483,6 +1507,12 @@ bool MeshOutput::SaveAny(const char* FileName, MeshIO::Format format) const
             throw Base::FileException("Export of 3MF failed", FileName);
         }
     }
+    else if (fileformat == MeshIO::GLTF) {
+        // write file
+        if (!SaveGLTF(str, FileName)) {
+            throw Base::FileException("Export of glTF failed", FileName);
+        }
+    }
     else if (fileformat == MeshIO::PY) {
         // write file
         if (!SavePython(str)) {
@@ -1560,6 +1590,8 @@ bool MeshOutput::SaveFormat(std::ostream& str, MeshIO::Format fmt) const
             return SaveVRML(str);
         case MeshIO::ThreeMF:
             return Save3MF(str);
+        case MeshIO::GLTF:
+            return SaveGLTF(str);
         case MeshIO::NAS:
             return SaveNastran(str);
         case MeshIO::PLY:
@@ -2174,6 +2206,14 @@ bool MeshOutput::Save3MF(std::ostream& output) const
     return writer.Save();
 }
 
+/** Saves the mesh object into a glTF file. */
+bool MeshOutput::SaveGLTF(std::ostream& output, const char* filename) const
+{
+    WriterGLTF writer(output, filename ? filename : "");
+    writer.AddMesh(_rclMesh, _transform);
+    return writer.Save();
+}
+
 /** Writes an IDTF file. */
 bool MeshOutput::SaveIDTF(std::ostream& str) const
 {
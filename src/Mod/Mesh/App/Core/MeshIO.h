@@ -66,7 +66,8 @@ enum Format
     AMF,
     SMF,
     ASY,
-    ThreeMF
+    ThreeMF,
+    GLTF
 };
 enum Binding
 {
@@ -145,6 +146,8 @@ public:
     void LoadXML(Base::XMLReader& reader);
     /** Loads the mesh object from a 3MF file. */
     bool Load3MF(std::istream& input);
+    /** Loads the mesh object from a glTF file, external buffers are searched in \a dirPath. */
+    bool LoadGLTF(std::istream& input, const std::string& dirPath = {});
     /** Loads a node from an OpenInventor file. */
     bool LoadMeshNode(std::istream& input);
     /** Loads an OpenInventor file. */
@@ -229,6 +232,8 @@ public:
     void SaveXML(Base::Writer& writer) const;
     /** Saves the mesh object into a 3MF file. */
     bool Save3MF(std::ostream& output) const;
+    /** Saves the mesh object into a glTF file, .gltf files get their binary data in a .bin file. */
+    bool SaveGLTF(std::ostream& output, const char* filename = nullptr) const;
     /** Saves a node to an OpenInventor file. */
     bool SaveMeshNode(std::ostream& output);
     /** Writes an IDTF file. */
@@ -25,6 +25,7 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <map>
 #include <queue>
 #include <stdexcept>
@@ -45,6 +46,64 @@
 
 using namespace MeshCore;
 
+namespace
+{
+// version and flags of the format written by MeshKernel::WriteCompact()
+const uint32_t CompactVersion = 0x020000;
+const uint32_t CompactBytePlanes = 0x1;
+
+void writeVarUInt(std::vector<unsigned char>& buffer, uint64_t value)
+{
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<unsigned char>(value));
+}
+
+void writeDelta(std::vector<unsigned char>& buffer, int64_t delta)
+{
+    // zig-zag encoding so that small negative differences are short, too
+    writeVarUInt(buffer,
+                 (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+}
+
+class DeltaReader
+{
+public:
+    DeltaReader(const unsigned char* begin, const unsigned char* end)
+        : pos(begin)
+        , end(end)
+    {}
+
+    int64_t readDelta()
+    {
+        uint64_t value = readVarUInt();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+private:
+    uint64_t readVarUInt()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos == end) {
+                break;
+            }
+            unsigned char byte = *pos++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        throw Base::BadFormatError("Invalid data structure");
+    }
+
+    const unsigned char* pos;
+    const unsigned char* end;
+};
+}  // namespace
+
 MeshKernel::MeshKernel()
 {
     _clBoundBox.SetVoid();
@@ -915,12 +974,166 @@ void MeshKernel::Write(std::ostream& rclOut) const
     str << _clBoundBox.MinZ << _clBoundBox.MaxZ;
 }
 
-void MeshKernel::Read(std::istream& rclIn)
+void MeshKernel::WriteCompact(std::ostream& rclOut, bool bytePlanes) const
 {
-    if (!rclIn || rclIn.bad()) {
+    if (!rclOut || rclOut.bad()) {
         return;
     }
 
+    Base::OutputStream str(rclOut);
+    // all numbers of the compact format are little endian, the stream
+    // swaps the bytes when set to big endian
+    bool swap = Base::SwapOrder() == HIGH_ENDIAN;
+    if (swap) {
+        str.setByteOrder(Base::Stream::BigEndian);
+    }
+
+    uint32_t flags = bytePlanes ? CompactBytePlanes : 0;
+    str << static_cast<uint32_t>(0xA0B0C0D0);
+    str << CompactVersion << flags;
+    str << static_cast<uint32_t>(CountPoints()) << static_cast<uint32_t>(CountFacets());
+
+    // the point block holds little endian floats, optionally split into four
+    // planes with the first, second, third and fourth byte of each float
+    std::size_t numFloats = 3 * _aclPointArray.size();
+    std::vector<char> points(numFloats * sizeof(float));
+    std::size_t index = 0;
+    for (const auto& it : _aclPointArray) {
+        for (float value : {it.x, it.y, it.z}) {
+            if (swap) {
+                Base::SwapEndian(value);
+            }
+            char bytes[sizeof(float)];
+            memcpy(bytes, &value, sizeof(float));
+            for (std::size_t byte = 0; byte < sizeof(float); byte++) {
+                if (bytePlanes) {
+                    points[byte * numFloats + index] = bytes[byte];
+                }
+                else {
+                    points[index * sizeof(float) + byte] = bytes[byte];
+                }
+            }
+            index++;
+        }
+    }
+    rclOut.write(points.data(), static_cast<std::streamsize>(points.size()));
+
+    // the point indices of each facet are stored as the difference of the first
+    // index to the first index of the previous facet, followed by the differences
+    // of the second and third index to the first one
+    std::vector<unsigned char> indices;
+    indices.reserve(4 * _aclFacetArray.size());
+    int64_t last = 0;
+    for (const auto& it : _aclFacetArray) {
+        auto first = static_cast<int64_t>(it._aulPoints[0]);
+        writeDelta(indices, first - last);
+        writeDelta(indices, static_cast<int64_t>(it._aulPoints[1]) - first);
+        writeDelta(indices, static_cast<int64_t>(it._aulPoints[2]) - first);
+        last = first;
+    }
+    str << static_cast<uint32_t>(indices.size());
+    rclOut.write(reinterpret_cast<const char*>(indices.data()),
+                 static_cast<std::streamsize>(indices.size()));
+
+    str << _clBoundBox.MinX << _clBoundBox.MaxX;
+    str << _clBoundBox.MinY << _clBoundBox.MaxY;
+    str << _clBoundBox.MinZ << _clBoundBox.MaxZ;
+}
+
+void MeshKernel::ReadCompact(Base::InputStream& str, std::istream& rclIn)
+{
+    uint32_t flags = 0, uCtPts = 0, uCtFts = 0;
+    str >> flags >> uCtPts >> uCtFts;
+
+    try {
+        MeshPointArray pointArray;
+        pointArray.resize(uCtPts);
+
+        std::size_t numFloats = 3 * static_cast<std::size_t>(uCtPts);
+        std::vector<char> points(numFloats * sizeof(float));
+        rclIn.read(points.data(), static_cast<std::streamsize>(points.size()));
+        if (!rclIn) {
+            throw Base::BadFormatError("Reading from stream failed");
+        }
+
+        bool bytePlanes = (flags & CompactBytePlanes) != 0;
+        bool swap = Base::SwapOrder() == HIGH_ENDIAN;
+        std::size_t index = 0;
+        for (auto& it : pointArray) {
+            for (float* value : {&it.x, &it.y, &it.z}) {
+                char bytes[sizeof(float)];
+                for (std::size_t byte = 0; byte < sizeof(float); byte++) {
+                    if (bytePlanes) {
+                        bytes[byte] = points[byte * numFloats + index];
+                    }
+                    else {
+                        bytes[byte] = points[index * sizeof(float) + byte];
+                    }
+                }
+                memcpy(value, bytes, sizeof(float));
+                if (swap) {
+                    Base::SwapEndian(*value);
+                }
+                index++;
+            }
+        }
+        points.clear();
+        points.shrink_to_fit();
+
+        uint32_t numBytes = 0;
+        str >> numBytes;
+        std::vector<unsigned char> indices(numBytes);
+        rclIn.read(reinterpret_cast<char*>(indices.data()), numBytes);
+        if (!rclIn) {
+            throw Base::BadFormatError("Reading from stream failed");
+        }
+
+        MeshFacetArray facetArray;
+        facetArray.resize(uCtFts);
+        DeltaReader reader(indices.data(), indices.data() + indices.size());
+        int64_t last = 0;
+        for (auto& it : facetArray) {
+            int64_t first = last + reader.readDelta();
+            int64_t second = first + reader.readDelta();
+            int64_t third = first + reader.readDelta();
+            // make sure to have valid indices
+            for (int64_t value : {first, second, third}) {
+                if (value < 0 || value >= static_cast<int64_t>(uCtPts)) {
+                    throw Base::BadFormatError("Invalid data structure");
+                }
+            }
+            it._aulPoints[0] = static_cast<PointIndex>(first);
+            it._aulPoints[1] = static_cast<PointIndex>(second);
+            it._aulPoints[2] = static_cast<PointIndex>(third);
+            last = first;
+        }
+
+        str >> _clBoundBox.MinX >> _clBoundBox.MaxX;
+        str >> _clBoundBox.MinY >> _clBoundBox.MaxY;
+        str >> _clBoundBox.MinZ >> _clBoundBox.MaxZ;
+
+        // If we reach this block no exception occurred and we can safely assign the mesh
+        _aclPointArray.swap(pointArray);
+        _aclFacetArray.swap(facetArray);
+    }
+    catch (const Base::BadFormatError&) {
+        throw;
+    }
+    catch (std::exception&) {
+        // Special handling of std::length_error
+        throw Base::BadFormatError("Reading from stream failed");
+    }
+
+    // the neighbourhood isn't stored, the rebuild sorts the edges in parallel
+    RebuildNeighbours();
+}
+
+bool MeshKernel::Read(std::istream& rclIn)
+{
+    if (!rclIn || rclIn.bad()) {
+        return false;
+    }
+
     // get header
     Base::InputStream str(rclIn);
 
@@ -935,6 +1148,15 @@ void MeshKernel::Read(std::istream& rclIn)
 
     // is it the new or old format?
     bool new_format = false;
+    if (magic == 0xA0B0C0D0 && version == CompactVersion) {
+        ReadCompact(str, rclIn);
+        return true;
+    }
+    if (swap_magic == 0xA0B0C0D0 && swap_version == CompactVersion) {
+        str.setByteOrder(Base::Stream::BigEndian);
+        ReadCompact(str, rclIn);
+        return true;
+    }
     if (magic == 0xA0B0C0D0 && version == 0x010000) {
         new_format = true;
     }
@@ -1096,6 +1318,8 @@ void MeshKernel::Read(std::istream& rclIn)
         _aclPointArray.swap(pointArray);
         _aclFacetArray.swap(facetArray);
     }
+
+    return false;
 }
 
 void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
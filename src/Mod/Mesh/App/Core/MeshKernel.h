@@ -34,6 +34,7 @@
 
 namespace Base
 {
+class InputStream;
 class Polygon2d;
 class ViewProjMethod;
 }  // namespace Base
@@ -79,7 +80,18 @@ public:
     //@{
     /// Binary streaming of data
     void Write(std::ostream& rclOut) const;
-    void Read(std::istream& rclIn);
+    /** Binary streaming in the compact format. The points are written as one
+     * block, optionally split into byte planes which compresses better, and
+     * the point indices of the facets are delta encoded. The neighbourhood is
+     * not written but rebuilt by Read(). All numbers are little endian.
+     * @note Older versions cannot read this format.
+     */
+    void WriteCompact(std::ostream& rclOut, bool bytePlanes = true) const;
+    /** Reads the data written by Write() or WriteCompact()
+     * @return true if the neighbourhood was rebuilt from the facets instead of
+     * being read from the stream.
+     */
+    bool Read(std::istream& rclIn);
     //@}
 
     /** @name Querying */
@@ -482,6 +494,9 @@ protected:
     inline Base::Vector3f GetGravityPoint(const MeshFacet& rclFacet) const;
 
 private:
+    /** Reads the data written by WriteCompact() after the version number. */
+    void ReadCompact(Base::InputStream& str, std::istream& rclIn);
+
     MeshPointArray _aclPointArray;        /**< Holds the array of geometric points. */
     MeshFacetArray _aclFacetArray;        /**< Holds the array of facets. */
     mutable Base::BoundBox3f _clBoundBox; /**< The current calculated bounding box. */
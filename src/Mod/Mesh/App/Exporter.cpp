@@ -328,6 +328,31 @@ void Exporter3MF::write()
 
 // ----------------------------------------------------------------------------
 
+ExporterGLTF::ExporterGLTF(const std::string& fileName)
+{
+    throwIfNoPermission(fileName);
+    writer = std::make_unique<MeshCore::WriterGLTF>(fileName);
+}
+
+ExporterGLTF::~ExporterGLTF()
+{
+    write();
+}
+
+bool ExporterGLTF::addMesh(const char* name, const MeshObject& mesh)
+{
+    // the mesh objects are kept in the mesh cache, so links to the same object
+    // pass the same kernel
+    return writer->AddMesh(mesh.getKernel(), mesh.getTransform(), name ? name : "");
+}
+
+void ExporterGLTF::write()
+{
+    writer->Save();
+}
+
+// ----------------------------------------------------------------------------
+
 ExporterAMF::ExporterAMF(std::string fileName,
                          const std::map<std::string, std::string>& meta,
                          bool compress)
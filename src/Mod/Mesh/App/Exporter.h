@@ -30,6 +30,7 @@
 #include "MeshFeature.h"
 #include "Core/MeshIO.h"
 #include "Core/IO/Writer3MF.h"
+#include "Core/IO/WriterGLTF.h"
 
 
 namespace Mesh
@@ -230,6 +231,32 @@ private:
     std::unique_ptr<Private> d;
 };
 
+/// Used for exporting to glTF 2.0 (.glb or .gltf)
+/*!
+ * The mesh of an object is written once and referenced by a node for each link to it,
+ * addObject() is used to add geometry and the destructor writes the file.
+ */
+class MeshExport ExporterGLTF: public Exporter
+{
+public:
+    explicit ExporterGLTF(const std::string& fileName);
+    ~ExporterGLTF() override;
+
+    ExporterGLTF(const ExporterGLTF&) = delete;
+    ExporterGLTF(ExporterGLTF&&) = delete;
+    ExporterGLTF& operator=(const ExporterGLTF&) = delete;
+    ExporterGLTF& operator=(ExporterGLTF&&) = delete;
+
+    bool addMesh(const char* name, const MeshObject& mesh) override;
+
+private:
+    /// Write the meshes of the added objects to the output file
+    void write();
+
+private:
+    std::unique_ptr<MeshCore::WriterGLTF> writer;
+};
+
 /// Used for exporting to Additive Manufacturing File (AMF) format
 /*!
  * The constructor and destructor write the beginning and end of the AMF,
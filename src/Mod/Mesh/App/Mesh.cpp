@@ -519,16 +519,19 @@ void MeshObject::save(std::ostream& out) const
 
 void MeshObject::load(std::istream& in)
 {
-    _kernel.Read(in);
+    bool rebuilt = _kernel.Read(in);
     this->_segments.clear();
 
 #ifndef FC_DEBUG
     try {
-        MeshCore::MeshEvalNeighbourhood nb(_kernel);
-        if (!nb.Evaluate()) {
-            Base::Console().Warning("Errors in neighbourhood of mesh found...");
-            _kernel.RebuildNeighbours();
-            Base::Console().Warning("fixed\n");
+        // a neighbourhood rebuilt while reading needs no check
+        if (!rebuilt) {
+            MeshCore::MeshEvalNeighbourhood nb(_kernel);
+            if (!nb.Evaluate()) {
+                Base::Console().Warning("Errors in neighbourhood of mesh found...");
+                _kernel.RebuildNeighbours();
+                Base::Console().Warning("fixed\n");
+            }
         }
 
         MeshCore::MeshEvalTopology eval(_kernel);
@@ -22,8 +22,11 @@
 
 #include "PreCompiled.h"
 
+#include <App/Application.h>
+#include <Base/ArrayViewPy.h>
 #include <Base/Converter.h>
 #include <Base/Exception.h>
+#include <Base/Interpreter.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/VectorPy.h>
@@ -748,9 +751,28 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
     hasSetValue();
 }
 
+void PropertyMeshKernel::detachExported(bool copy)
+{
+    // The arrays of a mesh that are exported to Python buffers must stay valid.
+    // So, the mesh is left to the buffers and the property continues with a new one.
+    if (!Base::ArrayViewPy::isExported(getValuePtr())) {
+        return;
+    }
+
+    Base::Reference<MeshObject> tmp(_meshObject);
+    _meshObject = copy ? new MeshObject(*tmp) : new MeshObject();
+    if (meshPyObject) {
+        Base::PyGILStateLocker lock;
+        meshPyObject->parentProperty = nullptr;
+        Py_DECREF(meshPyObject);
+        meshPyObject = nullptr;
+    }
+}
+
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
+    detachExported(false);
     *_meshObject = mesh;
     hasSetValue();
 }
@@ -758,6 +780,7 @@ void PropertyMeshKernel::setValue(const MeshObject& mesh)
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detachExported(true);
     _meshObject->setKernel(mesh);
     hasSetValue();
 }
@@ -765,6 +788,7 @@ void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
     aboutToSetValue();
+    detachExported(true);
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -772,6 +796,7 @@ void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detachExported(true);
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -807,6 +832,7 @@ unsigned int PropertyMeshKernel::getMemSize() const
 MeshObject* PropertyMeshKernel::startEditing()
 {
     aboutToSetValue();
+    detachExported(true);
     return static_cast<MeshObject*>(_meshObject);
 }
 
@@ -818,6 +844,7 @@ void PropertyMeshKernel::finishEditing()
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachExported(true);
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -826,6 +853,7 @@ void PropertyMeshKernel::setPointIndices(
     const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
     aboutToSetValue();
+    detachExported(true);
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
@@ -910,6 +938,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detachExported(true);
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     }
@@ -921,12 +950,24 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
 
 void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 {
-    _meshObject->save(writer.Stream());
+    // The compact format is much faster to write and read for large meshes but
+    // older versions cannot read it, so it must be turned on explicitly. Both
+    // formats are read by RestoreDocFile().
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Mesh");
+    if (hGrp->GetBool("CompactDocumentFormat", false)) {
+        _meshObject->getKernel().WriteCompact(writer.Stream(),
+                                              hGrp->GetBool("CompactBytePlanes", true));
+    }
+    else {
+        _meshObject->save(writer.Stream());
+    }
 }
 
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachExported(true);
     _meshObject->load(reader);
     hasSetValue();
 }
@@ -944,6 +985,7 @@ void PropertyMeshKernel::Paste(const App::Property& from)
     // Note: Copy the content, do NOT reference the same mesh object
     aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
+    detachExported(false);
     *(this->_meshObject) = *(prop._meshObject);
     hasSetValue();
 }
@@ -320,6 +320,10 @@ public:
     void Paste(const App::Property& from) override;
     //@}
 
+private:
+    /// Replaces the mesh if its arrays are exported to Python buffers
+    void detachExported(bool copy);
+
 private:
     Base::Reference<MeshObject> _meshObject;
     MeshPy* meshPyObject {nullptr};
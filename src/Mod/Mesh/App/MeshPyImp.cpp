@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 
+#include <Base/ArrayViewPy.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
 #include <Base/MatrixPy.h>
@@ -149,6 +150,8 @@ PyObject* MeshPy::copy(PyObject* args)
 
 PyObject* MeshPy::read(PyObject* args, PyObject* kwds)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     char* Name {};
     static const std::array<const char*, 2> keywords_path {"Filename", nullptr};
     if (Base::Wrapped_ParseTupleAndKeywords(args, kwds, "et", keywords_path, "utf-8", &Name)) {
@@ -178,6 +181,8 @@ PyObject* MeshPy::read(PyObject* args, PyObject* kwds)
     ext["PLY"] = MeshCore::MeshIO::PLY;
     ext["APLY"] = MeshCore::MeshIO::APLY;
     ext["PY"] = MeshCore::MeshIO::PY;
+    ext["GLTF"] = MeshCore::MeshIO::GLTF;
+    ext["GLB"] = MeshCore::MeshIO::GLTF;
 
     PyObject* input {};
     char* Ext {};
@@ -233,6 +238,8 @@ PyObject* MeshPy::write(PyObject* args, PyObject* kwds)
     ext["PY"] = MeshCore::MeshIO::PY;
     ext["ASY"] = MeshCore::MeshIO::ASY;
     ext["3MF"] = MeshCore::MeshIO::ThreeMF;
+    ext["GLTF"] = MeshCore::MeshIO::GLTF;
+    ext["GLB"] = MeshCore::MeshIO::GLTF;
 
     static const std::array<const char*, 5> keywords_path {"Filename",
                                                            "Format",
@@ -359,6 +366,8 @@ PyObject* MeshPy::writeInventor(PyObject* args)
 
 PyObject* MeshPy::offset(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     float Float {};
     if (!PyArg_ParseTuple(args, "f", &Float)) {
         return nullptr;
@@ -375,6 +384,8 @@ PyObject* MeshPy::offset(PyObject* args)
 
 PyObject* MeshPy::offsetSpecial(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     float Float {};
     float zmin {};
     float zmax {};
@@ -595,6 +606,8 @@ PyObject* MeshPy::section(PyObject* args, PyObject* kwds)
 
 PyObject* MeshPy::translate(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     float x {};
     float y {};
     float z {};
@@ -615,6 +628,8 @@ PyObject* MeshPy::translate(PyObject* args)
 
 PyObject* MeshPy::rotate(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     double x {};
     double y {};
     double z {};
@@ -637,6 +652,8 @@ PyObject* MeshPy::rotate(PyObject* args)
 
 PyObject* MeshPy::transform(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     PyObject* mat {};
     if (!PyArg_ParseTuple(args, "O!", &(Base::MatrixPy::Type), &mat)) {
         return nullptr;
@@ -653,6 +670,8 @@ PyObject* MeshPy::transform(PyObject* args)
 
 PyObject* MeshPy::transformToEigen(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -675,6 +694,8 @@ PyObject* MeshPy::getEigenSystem(PyObject* args)
 
 PyObject* MeshPy::addFacet(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     double x1 {};
     double y1 {};
     double z1 {};
@@ -728,6 +749,8 @@ PyObject* MeshPy::addFacet(PyObject* args)
 
 PyObject* MeshPy::addFacets(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     PyObject* list {};
     if (PyArg_ParseTuple(args, "O!", &PyList_Type, &list)) {
         Py::List list_f(list);
@@ -830,6 +853,8 @@ PyObject* MeshPy::addFacets(PyObject* args)
 
 PyObject* MeshPy::removeFacets(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     PyObject* list {};
     if (!PyArg_ParseTuple(args, "O", &list)) {
         return nullptr;
@@ -868,6 +893,8 @@ PyObject* MeshPy::getInternalFacets(PyObject* args)
 
 PyObject* MeshPy::rebuildNeighbourHood(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -879,6 +906,8 @@ PyObject* MeshPy::rebuildNeighbourHood(PyObject* args)
 
 PyObject* MeshPy::addMesh(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     PyObject* mesh {};
     if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &mesh)) {
         return nullptr;
@@ -895,6 +924,8 @@ PyObject* MeshPy::addMesh(PyObject* args)
 
 PyObject* MeshPy::setPoint(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long index {};
     PyObject* pnt {};
     if (!PyArg_ParseTuple(args, "kO!", &index, &(Base::VectorPy::Type), &pnt)) {
@@ -912,6 +943,8 @@ PyObject* MeshPy::setPoint(PyObject* args)
 
 PyObject* MeshPy::movePoint(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long index {};
     Base::Vector3d vec;
 
@@ -958,6 +991,54 @@ PyObject* MeshPy::getPointNormals(PyObject* args)
     PY_CATCH;
 }
 
+PyObject* MeshPy::getPointsBuffer(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const MeshCore::MeshPointArray& points = getMeshObjectPtr()->getKernel().GetPoints();
+        Base::ArrayViewPy::Layout layout;
+        layout.data = points.empty() ? nullptr : const_cast<float*>(&points.front().x);
+        layout.format = "f";
+        layout.itemSize = sizeof(float);
+        layout.rows = static_cast<Py_ssize_t>(points.size());
+        layout.columns = 3;
+        layout.rowStride = sizeof(MeshCore::MeshPoint);
+        layout.source = getMeshObjectPtr();
+        return Base::ArrayViewPy::create(layout, this);
+    }
+    PY_CATCH;
+}
+
+PyObject* MeshPy::getFacetsBuffer(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const MeshCore::MeshFacetArray& facets = getMeshObjectPtr()->getKernel().GetFacets();
+        Base::ArrayViewPy::Layout layout;
+        layout.data = facets.empty()
+            ? nullptr
+            : const_cast<MeshCore::PointIndex*>(&facets.front()._aulPoints[0]);
+        static_assert(sizeof(MeshCore::PointIndex) == sizeof(unsigned long),
+                      "Format of the point indices doesn't match");
+        layout.format = "L";
+        layout.itemSize = sizeof(MeshCore::PointIndex);
+        layout.rows = static_cast<Py_ssize_t>(facets.size());
+        layout.columns = 3;
+        layout.rowStride = sizeof(MeshCore::MeshFacet);
+        layout.source = getMeshObjectPtr();
+        return Base::ArrayViewPy::create(layout, this);
+    }
+    PY_CATCH;
+}
+
 PyObject* MeshPy::addSegment(PyObject* args)
 {
     PyObject* pylist {};
@@ -1082,6 +1163,8 @@ PyObject* MeshPy::meshFromSegment(PyObject* args)
 
 PyObject* MeshPy::clear(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1145,6 +1228,8 @@ PyObject* MeshPy::hasCorruptedFacets(PyObject* args)
 
 PyObject* MeshPy::removeNonManifolds(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1154,6 +1239,8 @@ PyObject* MeshPy::removeNonManifolds(PyObject* args)
 
 PyObject* MeshPy::removeNonManifoldPoints(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1199,6 +1286,8 @@ PyObject* MeshPy::getSelfIntersections(PyObject* args)
 
 PyObject* MeshPy::fixSelfIntersections(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1214,6 +1303,8 @@ PyObject* MeshPy::fixSelfIntersections(PyObject* args)
 
 PyObject* MeshPy::removeFoldsOnSurface(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1238,6 +1329,8 @@ PyObject* MeshPy::hasInvalidPoints(PyObject* args)
 
 PyObject* MeshPy::removeInvalidPoints(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1262,6 +1355,8 @@ PyObject* MeshPy::hasPointsOnEdge(PyObject* args)
 
 PyObject* MeshPy::removePointsOnEdge(PyObject* args, PyObject* kwds)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     PyObject* fillBoundary = Py_False;  // NOLINT
     static const std::array<const char*, 2> keywords {"FillBoundary", nullptr};
     if (!Base::Wrapped_ParseTupleAndKeywords(args,
@@ -1284,6 +1379,8 @@ PyObject* MeshPy::removePointsOnEdge(PyObject* args, PyObject* kwds)
 
 PyObject* MeshPy::flipNormals(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1335,6 +1432,8 @@ PyObject* MeshPy::getNonUniformOrientedFacets(PyObject* args)
 
 PyObject* MeshPy::harmonizeNormals(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1361,6 +1460,8 @@ PyObject* MeshPy::countComponents(PyObject* args)
 
 PyObject* MeshPy::removeComponents(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long count {};
     if (!PyArg_ParseTuple(args, "k", &count)) {
         return nullptr;
@@ -1379,6 +1480,8 @@ PyObject* MeshPy::removeComponents(PyObject* args)
 
 PyObject* MeshPy::fillupHoles(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long len {};
     int level = 0;
     float max_area = 0.0F;
@@ -1410,6 +1513,8 @@ PyObject* MeshPy::fillupHoles(PyObject* args)
 
 PyObject* MeshPy::fixIndices(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1425,6 +1530,8 @@ PyObject* MeshPy::fixIndices(PyObject* args)
 
 PyObject* MeshPy::fixCaps(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     float fMaxAngle = Base::toRadians<float>(150.0F);
     float fSplitFactor = 0.25F;
     if (!PyArg_ParseTuple(args, "|ff", &fMaxAngle, &fSplitFactor)) {
@@ -1442,6 +1549,8 @@ PyObject* MeshPy::fixCaps(PyObject* args)
 
 PyObject* MeshPy::fixDeformations(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     float fMaxAngle {};
     float fEpsilon = MeshCore::MeshDefinitions::_fMinPointDistanceP2;
     if (!PyArg_ParseTuple(args, "f|f", &fMaxAngle, &fEpsilon)) {
@@ -1459,6 +1568,8 @@ PyObject* MeshPy::fixDeformations(PyObject* args)
 
 PyObject* MeshPy::fixDegenerations(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     float fEpsilon = MeshCore::MeshDefinitions::_fMinPointDistanceP2;
     if (!PyArg_ParseTuple(args, "|f", &fEpsilon)) {
         return nullptr;
@@ -1475,6 +1586,8 @@ PyObject* MeshPy::fixDegenerations(PyObject* args)
 
 PyObject* MeshPy::removeDuplicatedPoints(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1490,6 +1603,8 @@ PyObject* MeshPy::removeDuplicatedPoints(PyObject* args)
 
 PyObject* MeshPy::removeDuplicatedFacets(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1505,6 +1620,8 @@ PyObject* MeshPy::removeDuplicatedFacets(PyObject* args)
 
 PyObject* MeshPy::refine(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1520,6 +1637,8 @@ PyObject* MeshPy::refine(PyObject* args)
 
 PyObject* MeshPy::removeNeedles(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     float length {};
     if (!PyArg_ParseTuple(args, "f", &length)) {
         return nullptr;
@@ -1536,6 +1655,8 @@ PyObject* MeshPy::removeNeedles(PyObject* args)
 
 PyObject* MeshPy::removeFullBoundaryFacets(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1551,6 +1672,8 @@ PyObject* MeshPy::removeFullBoundaryFacets(PyObject* args)
 
 PyObject* MeshPy::mergeFacets(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1566,6 +1689,8 @@ PyObject* MeshPy::mergeFacets(PyObject* args)
 
 PyObject* MeshPy::optimizeTopology(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     float fMaxAngle = -1.0F;
     if (!PyArg_ParseTuple(
             args,
@@ -1586,6 +1711,8 @@ PyObject* MeshPy::optimizeTopology(PyObject* args)
 
 PyObject* MeshPy::optimizeEdges(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1602,6 +1729,8 @@ PyObject* MeshPy::optimizeEdges(PyObject* args)
 
 PyObject* MeshPy::splitEdges(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     if (!PyArg_ParseTuple(args, "")) {
         return nullptr;
     }
@@ -1617,6 +1746,8 @@ PyObject* MeshPy::splitEdges(PyObject* args)
 
 PyObject* MeshPy::splitEdge(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long facet {};
     unsigned long neighbour {};
     PyObject* vertex {};
@@ -1656,6 +1787,8 @@ PyObject* MeshPy::splitEdge(PyObject* args)
 
 PyObject* MeshPy::splitFacet(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long facet {};
     PyObject* vertex1 {};
     PyObject* vertex2 {};
@@ -1694,6 +1827,8 @@ PyObject* MeshPy::splitFacet(PyObject* args)
 
 PyObject* MeshPy::swapEdge(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long facet {};
     unsigned long neighbour {};
     if (!PyArg_ParseTuple(args, "kk", &facet, &neighbour)) {
@@ -1728,6 +1863,8 @@ PyObject* MeshPy::swapEdge(PyObject* args)
 
 PyObject* MeshPy::collapseEdge(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long facet {};
     unsigned long neighbour {};
     if (!PyArg_ParseTuple(args, "kk", &facet, &neighbour)) {
@@ -1762,6 +1899,8 @@ PyObject* MeshPy::collapseEdge(PyObject* args)
 
 PyObject* MeshPy::collapseFacet(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long facet {};
     if (!PyArg_ParseTuple(args, "k", &facet)) {
         return nullptr;
@@ -1783,6 +1922,8 @@ PyObject* MeshPy::collapseFacet(PyObject* args)
 
 PyObject* MeshPy::insertVertex(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long facet {};
     PyObject* vertex {};
     if (!PyArg_ParseTuple(args, "kO!", &facet, &Base::VectorPy::Type, &vertex)) {
@@ -1809,6 +1950,8 @@ PyObject* MeshPy::insertVertex(PyObject* args)
 
 PyObject* MeshPy::snapVertex(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     unsigned long facet {};
     PyObject* vertex {};
     if (!PyArg_ParseTuple(args, "kO!", &facet, &Base::VectorPy::Type, &vertex)) {
@@ -1843,6 +1986,8 @@ PyObject* MeshPy::printInfo(PyObject* args)
 
 PyObject* MeshPy::collapseFacets(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     PyObject* pcObj = nullptr;
     if (!PyArg_ParseTuple(args, "O", &pcObj)) {
         return nullptr;
@@ -1901,6 +2046,8 @@ PyObject* MeshPy::foraminate(PyObject* args)
 
 PyObject* MeshPy::cut(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     PyObject* poly {};
     int mode {};
     if (!PyArg_ParseTuple(args, "Oi", &poly, &mode)) {
@@ -1937,6 +2084,8 @@ PyObject* MeshPy::cut(PyObject* args)
 
 PyObject* MeshPy::trim(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     PyObject* poly {};
     int mode {};
     if (!PyArg_ParseTuple(args, "Oi", &poly, &mode)) {
@@ -1973,6 +2122,8 @@ PyObject* MeshPy::trim(PyObject* args)
 
 PyObject* MeshPy::trimByPlane(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     PyObject* base {};
     PyObject* norm {};
     if (!PyArg_ParseTuple(args,
@@ -1995,6 +2146,8 @@ PyObject* MeshPy::trimByPlane(PyObject* args)
 
 PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     const char* method = "Laplace";
     int iter = 1;
     double lambda = 0;
@@ -2058,6 +2211,8 @@ PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds)
 
 PyObject* MeshPy::decimate(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getMeshObjectPtr());
+
     float fTol {};
     float fRed {};
     if (PyArg_ParseTuple(args, "ff", &fTol, &fRed)) {
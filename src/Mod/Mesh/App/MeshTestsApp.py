@@ -747,3 +747,80 @@ class MeshProperty(unittest.TestCase):
         self.assertEqual(len(material2["emissiveColor"]), len1 + len2)
         self.assertEqual(len(material2["shininess"]), len1 + len2)
         self.assertEqual(len(material2["transparency"]), len1 + len2)
+
+
+class MeshBuffer(unittest.TestCase):
+    def setUp(self):
+        self.mesh = Mesh.createBox(1.0, 2.0, 3.0)
+        self.points = [[p.x, p.y, p.z] for p in self.mesh.Points]
+        self.facets = [list(f.PointIndices) for f in self.mesh.Facets]
+
+    def testPointsBuffer(self):
+        buf = self.mesh.getPointsBuffer()
+        self.assertEqual(buf.shape, (8, 3))
+        self.assertEqual(buf.format, "f")
+        self.assertEqual(buf.itemsize, 4)
+        self.assertEqual(buf.strides[1], 4)
+        self.assertGreaterEqual(buf.strides[0], 12)
+        self.assertTrue(buf.readonly)
+        self.assertEqual(buf.tolist(), self.points)
+
+    def testFacetsBuffer(self):
+        buf = self.mesh.getFacetsBuffer()
+        self.assertEqual(buf.shape, (12, 3))
+        self.assertEqual(buf.format, "L")
+        self.assertEqual(buf.strides[1], buf.itemsize)
+        self.assertGreaterEqual(buf.strides[0], 3 * buf.itemsize)
+        self.assertTrue(buf.readonly)
+        self.assertEqual(buf.tolist(), self.facets)
+
+    def testReadOnly(self):
+        buf = self.mesh.getPointsBuffer()
+        with self.assertRaises(TypeError):
+            buf[0, 0] = 1.0
+
+    def testLifetime(self):
+        buf = Mesh.createBox(1.0, 2.0, 3.0).getPointsBuffer()
+        self.assertEqual(buf.tolist(), self.points)
+
+    def testModifyWhileExported(self):
+        buf = self.mesh.getFacetsBuffer()
+        with self.assertRaises(BufferError):
+            self.mesh.addMesh(Mesh.createSphere(1.0))
+        with self.assertRaises(BufferError):
+            self.mesh.translate(1.0, 0.0, 0.0)
+        self.assertEqual(self.mesh.CountFacets, 12)
+        self.assertEqual(buf.tolist(), self.facets)
+
+        buf.release()
+        self.mesh.addMesh(Mesh.createSphere(1.0))
+        self.assertGreater(self.mesh.CountFacets, 12)
+
+    def testModifyInPlaceWhileExported(self):
+        buf = self.mesh.getFacetsBuffer()
+        with self.assertRaises(BufferError):
+            self.mesh.flipNormals()
+        with self.assertRaises(BufferError):
+            self.mesh.smooth()
+        with self.assertRaises(BufferError):
+            self.mesh.fillupHoles(3)
+        self.assertEqual(buf.tolist(), self.facets)
+
+        buf.release()
+        self.mesh.flipNormals()
+        i, j, k = self.facets[0]
+        self.assertEqual(self.mesh.Facets[0].PointIndices, (i, k, j))
+
+    def testPropertyWhileExported(self):
+        doc = FreeCAD.newDocument("MeshBuffer")
+        try:
+            feature = doc.addObject("Mesh::Feature", "Mesh")
+            feature.Mesh = self.mesh
+            buf = feature.Mesh.getPointsBuffer()
+
+            # the property continues with a new mesh and the buffer keeps the old one
+            feature.Mesh = Mesh.createSphere(1.0)
+            self.assertGreater(feature.Mesh.CountPoints, 8)
+            self.assertEqual(buf.tolist(), self.points)
+        finally:
+            FreeCAD.closeDocument(doc.Name)
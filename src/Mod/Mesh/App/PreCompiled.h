@@ -42,16 +42,21 @@
 #include <cfloat>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <fcntl.h>
 #include <fstream>
 #include <ios>
 
 // STL
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <list>
 #include <map>
+#include <numeric>
 #include <queue>
 #include <set>
 #include <sstream>
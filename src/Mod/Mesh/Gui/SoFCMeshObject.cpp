@@ -21,17 +21,27 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+
+#ifndef FC_OS_WIN32
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES 1
+#endif
+#endif
+
 #ifndef _PreComp_
 #include <algorithm>
 #include <climits>
+#include <map>
 #ifdef FC_OS_WIN32
 #include <windows.h>
 #endif
 #ifdef FC_OS_MACOSX
 #include <OpenGL/gl.h>
+#include <OpenGL/glext.h>
 #include <OpenGL/glu.h>
 #else
 #include <GL/gl.h>
+#include <GL/glext.h>
 #include <GL/glu.h>
 #endif
 #include <Inventor/SbLine.h>
@@ -49,9 +59,11 @@
 #include <Inventor/details/SoLineDetail.h>
 #include <Inventor/misc/SoState.h>
 #endif
+#include <Inventor/C/glue/gl.h>
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Gui/GLBuffer.h>
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/SoFCSelectionAction.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
@@ -601,6 +613,209 @@ inline SbVec3f sbvec3f(const Base::Vector3f& _v)
 
 SO_NODE_SOURCE(SoFCMeshObjectShape)
 
+/**
+ * The flat shaded triangles of the mesh as interleaved normals and points, and the
+ * vertex buffer objects they are uploaded to. The buffers of each OpenGL context
+ * remember the version of the arrays they hold so that they can be brought up to date
+ * with the modified ranges only.
+ */
+class SoFCMeshObjectShape::GLArrays
+{
+public:
+    // the number of floats of a facet, a normal and a point for each corner
+    static constexpr std::size_t FacetSize = 18;
+    // the number of facets compared at once to find the modified ranges
+    static constexpr std::size_t BlockSize = 4096;
+
+    GLArrays()
+        : vertices(GL_ARRAY_BUFFER)
+        , proxyVertices(GL_ARRAY_BUFFER)
+    {}
+
+    void setVertices(std::vector<float>& array);
+    void updateProxy(unsigned int triangleLimit);
+    void render(SoGLRenderAction* action, bool proxy);
+    float pointSize() const
+    {
+        return std::min<float>(static_cast<float>(proxyStep), 3.0F);
+    }
+
+private:
+    using Range = std::pair<std::size_t, std::size_t>;
+
+    bool canRenderVBO(SoGLRenderAction* action) const;
+    static bool upload(Gui::OpenGLMultiBuffer& buffer,
+                       std::map<uint32_t, unsigned long>& uploaded,
+                       uint32_t context,
+                       unsigned long version,
+                       const std::vector<float>& array,
+                       const std::vector<Range>* modified);
+
+    std::vector<float> vertex_array;
+    // the ranges of vertex_array, in floats, modified by the last call of setVertices()
+    std::vector<Range> modified;
+    bool resized {true};
+    unsigned long version {0};
+
+    // the gravity points of every proxyStep-th facet, rendered during navigation
+    std::vector<float> proxy_array;
+    unsigned long proxySource {0};
+    unsigned long proxyVersion {0};
+    unsigned int proxyStep {0};
+
+    // the versions of the arrays held by the buffers of each context
+    std::map<uint32_t, unsigned long> uploaded;
+    std::map<uint32_t, unsigned long> proxyUploaded;
+    Gui::OpenGLMultiBuffer vertices;
+    Gui::OpenGLMultiBuffer proxyVertices;
+};
+
+void SoFCMeshObjectShape::GLArrays::setVertices(std::vector<float>& array)
+{
+    modified.clear();
+    resized = array.size() != vertex_array.size();
+    if (!resized) {
+        const std::size_t block = FacetSize * BlockSize;
+        for (std::size_t first = 0; first < array.size(); first += block) {
+            std::size_t count = std::min(block, array.size() - first);
+            auto it = array.begin() + first;
+            if (!std::equal(it, it + count, vertex_array.begin() + first)) {
+                if (!modified.empty() && modified.back().first + modified.back().second == first) {
+                    modified.back().second += count;
+                }
+                else {
+                    modified.emplace_back(first, count);
+                }
+            }
+        }
+    }
+
+    vertex_array.swap(array);
+    ++version;
+}
+
+void SoFCMeshObjectShape::GLArrays::updateProxy(unsigned int triangleLimit)
+{
+    std::size_t numFacets = vertex_array.size() / FacetSize;
+    auto step = static_cast<unsigned int>(numFacets / std::max(triangleLimit, 1U) + 1);
+    if (proxySource == version && proxyStep == step) {
+        return;
+    }
+
+    proxy_array.clear();
+    proxy_array.reserve(6 * (numFacets / step + 1));
+    for (std::size_t i = 0; i < numFacets; i += step) {
+        const float* facet = &vertex_array[i * FacetSize];
+        // all corners have the normal of the facet
+        proxy_array.insert(proxy_array.end(), facet, facet + 3);
+        for (int j = 3; j < 6; j++) {
+            proxy_array.push_back((facet[j] + facet[j + 6] + facet[j + 12]) / 3.0F);
+        }
+    }
+
+    proxySource = version;
+    proxyStep = step;
+    ++proxyVersion;
+}
+
+bool SoFCMeshObjectShape::GLArrays::canRenderVBO(SoGLRenderAction* action) const
+{
+    SbBool useVBO = true;
+    Gui::SoGLVBOActivatedElement::get(action->getState(), useVBO);
+    if (!useVBO) {
+        return false;
+    }
+
+    static bool init = false;
+    static bool vboAvailable = false;
+    if (!init) {
+        vboAvailable = Gui::OpenGLBuffer::isVBOSupported(action->getCacheContext());
+        init = true;
+    }
+
+    return vboAvailable;
+}
+
+/**
+ * Binds the buffer of the context and brings it up to date. If it holds the previous
+ * version of the array only the modified ranges are written.
+ */
+bool SoFCMeshObjectShape::GLArrays::upload(Gui::OpenGLMultiBuffer& buffer,
+                                           std::map<uint32_t, unsigned long>& uploaded,
+                                           uint32_t context,
+                                           unsigned long version,
+                                           const std::vector<float>& array,
+                                           const std::vector<Range>* modified)
+{
+    buffer.setCurrentContext(context);
+    bool created = buffer.isCreated(context);
+    if (!created && !buffer.create()) {
+        return false;
+    }
+
+    buffer.bind();
+    auto it = uploaded.find(context);
+    if (!created || it == uploaded.end()) {
+        buffer.allocate(array.data(), static_cast<intptr_t>(array.size() * sizeof(float)));
+    }
+    else if (it->second != version) {
+        if (modified && it->second + 1 == version) {
+            for (const auto& range : *modified) {
+                buffer.write(static_cast<intptr_t>(range.first * sizeof(float)),
+                             array.data() + range.first,
+                             static_cast<intptr_t>(range.second * sizeof(float)));
+            }
+        }
+        else {
+            buffer.allocate(array.data(), static_cast<intptr_t>(array.size() * sizeof(float)));
+        }
+    }
+
+    uploaded[context] = version;
+    return true;
+}
+
+void SoFCMeshObjectShape::GLArrays::render(SoGLRenderAction* action, bool proxy)
+{
+    const std::vector<float>& array = proxy ? proxy_array : vertex_array;
+    // six floats per vertex
+    auto cnt = static_cast<GLsizei>(array.size() / 6);
+    if (cnt == 0) {
+        return;
+    }
+
+    GLenum mode = proxy ? GL_POINTS : GL_TRIANGLES;
+    Gui::OpenGLMultiBuffer& buffer = proxy ? proxyVertices : vertices;
+
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_VERTEX_ARRAY);
+
+    bool useVBO = false;
+    if (canRenderVBO(action)) {
+        uint32_t context = action->getCacheContext();
+        if (proxy) {
+            useVBO = upload(buffer, proxyUploaded, context, proxyVersion, array, nullptr);
+        }
+        else {
+            const std::vector<Range>* ranges = resized ? nullptr : &modified;
+            useVBO = upload(buffer, uploaded, context, version, array, ranges);
+        }
+    }
+
+    if (useVBO) {
+        glInterleavedArrays(GL_N3F_V3F, 0, nullptr);
+        glDrawArrays(mode, 0, cnt);
+        buffer.release();
+    }
+    else {
+        glInterleavedArrays(GL_N3F_V3F, 0, array.data());
+        glDrawArrays(mode, 0, cnt);
+    }
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+}
+
 void SoFCMeshObjectShape::initClass()
 {
     SO_NODE_INIT_CLASS(SoFCMeshObjectShape, SoShape, "Shape");
@@ -608,6 +823,7 @@ void SoFCMeshObjectShape::initClass()
 
 SoFCMeshObjectShape::SoFCMeshObjectShape()
     : renderTriangleLimit(UINT_MAX)
+    , glArrays(std::make_unique<GLArrays>())
 {
     SO_NODE_CONSTRUCTOR(SoFCMeshObjectShape);
     setName(SoFCMeshObjectShape::getClassTypeId().getName());
@@ -672,7 +888,11 @@ void SoFCMeshObjectShape::GLRender(SoGLRenderAction* action)
             }
         }
         else {
-#if 0 && defined(RENDER_GLARRAYS)
+#ifdef RENDER_GLARRAYS
+            if (updateGLArray) {
+                updateGLArray = false;
+                generateGLArrays(state);
+            }
             renderCoordsGLArray(action);
 #else
             drawPoints(mesh, needNormals, ccw);
@@ -884,11 +1104,7 @@ void SoFCMeshObjectShape::generateGLArrays(SoState* state)
 {
     const Mesh::MeshObject* mesh = SoFCMeshObjectElement::get(state);
 
-    this->index_array.resize(0);
-    this->vertex_array.resize(0);
-
     std::vector<float> face_vertices;
-    std::vector<int32_t> face_indices;
 
     const MeshCore::MeshKernel& kernel = mesh->getKernel();
     const MeshCore::MeshPointArray& cP = kernel.GetPoints();
@@ -896,9 +1112,7 @@ void SoFCMeshObjectShape::generateGLArrays(SoState* state)
 
     // Flat shading
     face_vertices.reserve(3 * cF.size() * 6);  // duplicate each vertex
-    face_indices.resize(3 * cF.size());
 
-    int indexed = 0;
     for (const auto& it : cF) {
         Base::Vector3f n = kernel.GetFacet(it).GetNormal();
         for (Mesh::PointIndex ptIndex : it._aulPoints) {
@@ -909,43 +1123,24 @@ void SoFCMeshObjectShape::generateGLArrays(SoState* state)
             face_vertices.push_back(v.x);
             face_vertices.push_back(v.y);
             face_vertices.push_back(v.z);
-
-            face_indices[indexed] = indexed;
-            indexed++;
         }
     }
-    this->index_array.swap(face_indices);
-    this->vertex_array.swap(face_vertices);
+    glArrays->setVertices(face_vertices);
 }
 
 void SoFCMeshObjectShape::renderFacesGLArray(SoGLRenderAction* action)
 {
-    (void)action;
-    GLsizei cnt = static_cast<GLsizei>(index_array.size());
-
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-    glInterleavedArrays(GL_N3F_V3F, 0, vertex_array.data());
-    glDrawElements(GL_TRIANGLES, cnt, GL_UNSIGNED_INT, index_array.data());
-
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
+    glArrays->render(action, false);
 }
 
+/**
+ * Renders the gravity points of a subset of triangles.
+ */
 void SoFCMeshObjectShape::renderCoordsGLArray(SoGLRenderAction* action)
 {
-    (void)action;
-    int cnt = index_array.size();
-
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-    glInterleavedArrays(GL_N3F_V3F, 0, vertex_array.data());
-    glDrawElements(GL_POINTS, cnt, GL_UNSIGNED_INT, index_array.data());
-
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
+    glArrays->updateProxy(this->renderTriangleLimit);
+    glPointSize(glArrays->pointSize());
+    glArrays->render(action, true);
 }
 
 void SoFCMeshObjectShape::doAction(SoAction* action)
@@ -23,6 +23,7 @@
 #ifndef MESHGUI_SOFCMESHOBJECT_H
 #define MESHGUI_SOFCMESHOBJECT_H
 
+#include <memory>
 #include <Inventor/elements/SoReplacedElement.h>
 #include <Inventor/fields/SoSFUInt32.h>
 #include <Inventor/fields/SoSFVec3f.h>
@@ -163,6 +164,10 @@ protected:
  * (e.g. moving, rotating, zooming, spinning, etc.) with the mesh then the GLRender() method
  * renders only the gravity points of a subset of the triangles.
  * If there is no user interaction with the mesh then all triangles are rendered.
+ *
+ * The triangles are kept in vertex buffer objects if the driver supports them. When the
+ * mesh is modified but keeps its number of facets, e.g. after harmonizing the normals or
+ * smoothing it, only the modified parts of the buffers are uploaded again.
  * The limit of maximum allowed triangles can be specified in \a renderTriangleLimit, the
  * default value is set to 100.000.
  *
@@ -231,13 +236,14 @@ private:
     void renderCoordsGLArray(SoGLRenderAction* action);
 
 private:
+    class GLArrays;
+
     GLuint* selectBuf {nullptr};
     GLfloat modelview[16] {};
     GLfloat projection[16] {};
     // Vertex array handling
-    std::vector<int32_t> index_array;
-    std::vector<float> vertex_array;
-    SbBool updateGLArray {false};
+    std::unique_ptr<GLArrays> glArrays;
+    SbBool updateGLArray {true};
 };
 
 class MeshGuiExport SoFCMeshSegmentShape: public SoShape
@@ -11,6 +11,7 @@ FreeCAD.addImportType("Object File Format Mesh (*.off *.OFF)", "Mesh")
 FreeCAD.addImportType("Stanford Triangle Mesh (*.ply *.PLY)", "Mesh")
 FreeCAD.addImportType("Simple Model Format (*.smf *.SMF)", "Mesh")
 FreeCAD.addImportType("3D Manufacturing Format (*.3mf *.3MF)", "Mesh")
+FreeCAD.addImportType("glTF Mesh (*.glb *.GLB *.gltf *.GLTF)", "Mesh")
 
 FreeCAD.addExportType("STL Mesh (*.stl *.ast)", "Mesh")
 FreeCAD.addExportType("Binary Mesh (*.bms)", "Mesh")
@@ -20,5 +21,6 @@ FreeCAD.addExportType("Stanford Triangle Mesh (*.ply)", "Mesh")
 FreeCAD.addExportType("Additive Manufacturing Format (*.amf)", "Mesh")
 FreeCAD.addExportType("Simple Model Format (*.smf)", "Mesh")
 FreeCAD.addExportType("3D Manufacturing Format (*.3mf)", "Mesh")
+FreeCAD.addExportType("glTF Mesh (*.glb *.gltf)", "Mesh")
 
 FreeCAD.__unit_test__ += ["MeshTestsApp"]
@@ -22,10 +22,13 @@
 
 #include "PreCompiled.h"
 
+#include <App/Application.h>
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 #include <Base/PyObjectBase.h>
 
+#include "Mesher.h"
+
 
 namespace MeshPart
 {
@@ -44,6 +47,12 @@ PyMOD_INIT_FUNC(MeshPart)
         PyMOD_Return(nullptr);
     }
     PyObject* mod = MeshPart::initModule();
+
+    // the cached triangulations keep the shapes of a closed document alive
+    App::GetApplication().signalDeleteDocument.connect([](const App::Document&) {
+        MeshPart::Mesher::clearCache();
+    });
+
     Base::Console().Log("Loading MeshPart module... done\n");
     PyMOD_Return(mod);
 }
@@ -23,6 +23,8 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <list>
+#include <mutex>
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
@@ -30,6 +32,7 @@
 #include <TopoDS_Shape.hxx>
 #endif
 
+#include <App/Application.h>
 #include <Base/Console.h>
 #include <Base/Tools.h>
 #include <Mod/Mesh/App/Mesh.h>
@@ -124,6 +127,94 @@ int MeshingOutput::sync()
 namespace MeshPart
 {
 
+// The merged triangulation of a shape with a segment for each of its faces
+struct BrepTriangulation
+{
+    std::vector<Base::Vector3d> points;
+    std::vector<Part::TopoShape::Facet> facets;
+    std::vector<Part::BRepMesh::Segment> segments;
+
+    std::size_t getMemSize() const
+    {
+        std::size_t size = points.capacity() * sizeof(Base::Vector3d)
+            + facets.capacity() * sizeof(Part::TopoShape::Facet);
+        for (const auto& it : segments) {
+            size += it.capacity() * sizeof(std::size_t);
+        }
+        return size;
+    }
+};
+
+// Keeps the triangulations of the most recently meshed shapes, so that meshing
+// the same shape again with the same parameters skips the mesher and the merge.
+// The cache holds at most maxEntries triangulations and at most maxBytes bytes.
+class BrepTriangulationCache
+{
+public:
+    static BrepTriangulationCache& instance()
+    {
+        static BrepTriangulationCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<const BrepTriangulation>
+    find(const TopoDS_Shape& shape, double deflection, double angularDeflection, bool relative)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (it->shape.IsEqual(shape) && it->deflection == deflection
+                && it->angularDeflection == angularDeflection && it->relative == relative) {
+                entries.splice(entries.begin(), entries, it);
+                return it->triangulation;
+            }
+        }
+        return nullptr;
+    }
+
+    void store(const TopoDS_Shape& shape,
+               double deflection,
+               double angularDeflection,
+               bool relative,
+               const std::shared_ptr<const BrepTriangulation>& triangulation,
+               std::size_t maxBytes)
+    {
+        std::size_t size = triangulation->getMemSize();
+        std::lock_guard<std::mutex> lock(mutex);
+        if (size > maxBytes) {
+            return;
+        }
+        entries.push_front({shape, deflection, angularDeflection, relative, triangulation, size});
+        bytes += size;
+        while (entries.size() > maxEntries || bytes > maxBytes) {
+            bytes -= entries.back().size;
+            entries.pop_back();
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        bytes = 0;
+    }
+
+private:
+    struct Entry
+    {
+        TopoDS_Shape shape;
+        double deflection;
+        double angularDeflection;
+        bool relative;
+        std::shared_ptr<const BrepTriangulation> triangulation;
+        std::size_t size;
+    };
+
+    static const std::size_t maxEntries = 4;
+    std::mutex mutex;
+    std::list<Entry> entries;
+    std::size_t bytes {0};
+};
+
 class BrepMesh
 {
     bool segments;
@@ -135,12 +226,10 @@ public:
         , colors(c)
     {}
 
-    Mesh::MeshObject* create(const std::vector<Part::TopoShape::Domain>& domains) const
+    Mesh::MeshObject* create(const BrepTriangulation& triangulation) const
     {
-        std::vector<Base::Vector3d> points;
-        std::vector<Part::TopoShape::Facet> facets;
-        Part::BRepMesh mesh;
-        mesh.getFacesFromDomains(domains, points, facets);
+        const auto& points = triangulation.points;
+        const auto& facets = triangulation.facets;
 
         MeshCore::MeshFacetArray faces;
         faces.reserve(facets.size());
@@ -168,11 +257,11 @@ public:
             colorMap[colors[i]].push_back(i);
         }
 
-        bool createSegm = (colors.size() == domains.size());
+        bool createSegm = (colors.size() == triangulation.segments.size());
 
         // add a segment for the face
         if (createSegm || this->segments) {
-            auto segments = mesh.createSegments();
+            const auto& segments = triangulation.segments;
             meshSegments.reserve(segments.size());
             std::transform(segments.cbegin(),
                            segments.cend(),
@@ -221,18 +310,46 @@ Mesher::Mesher(const TopoDS_Shape& s)
 
 Mesher::~Mesher() = default;
 
+void Mesher::clearCache()
+{
+    BrepTriangulationCache::instance().clear();
+}
+
 Mesh::MeshObject* Mesher::createStandard() const
 {
-    if (!shape.IsNull()) {
-        BRepTools::Clean(shape);
-        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Mesh/Meshing/Standard");
+    bool useCache = hGrp->GetBool("CacheTriangulation", true);
+    // size limit in MB
+    std::size_t maxBytes = std::size_t(hGrp->GetUnsigned("CacheTriangulationSize", 256)) << 20;
+
+    auto& cache = BrepTriangulationCache::instance();
+    std::shared_ptr<const BrepTriangulation> triangulation;
+    if (useCache) {
+        triangulation = cache.find(shape, deflection, angularDeflection, relative);
     }
+    if (!triangulation) {
+        if (!shape.IsNull()) {
+            BRepTools::Clean(shape);
+            BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
+        }
+
+        std::vector<Part::TopoShape::Domain> domains;
+        Part::TopoShape(shape).getDomains(domains);
 
-    std::vector<Part::TopoShape::Domain> domains;
-    Part::TopoShape(shape).getDomains(domains);
+        auto data = std::make_shared<BrepTriangulation>();
+        Part::BRepMesh mesh;
+        mesh.getFacesFromDomains(domains, data->points, data->facets);
+        data->segments = mesh.createSegments();
+        triangulation = data;
+
+        if (useCache && !shape.IsNull()) {
+            cache.store(shape, deflection, angularDeflection, relative, triangulation, maxBytes);
+        }
+    }
 
     BrepMesh brepmesh(this->segments, this->colors);
-    return brepmesh.create(domains);
+    return brepmesh.create(*triangulation);
 }
 
 Mesh::MeshObject* Mesher::createMesh() const
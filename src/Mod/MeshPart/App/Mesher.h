@@ -213,6 +213,9 @@ public:
 
     Mesh::MeshObject* createMesh() const;
 
+    /// Drops the cached triangulations of the standard mesher
+    static void clearCache();
+
 private:
     Mesh::MeshObject* createStandard() const;
     Mesh::MeshObject* createFrom(SMESH_Mesh*) const;
@@ -41,8 +41,10 @@
 // STL
 #include <algorithm>
 #include <array>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <stdexcept>
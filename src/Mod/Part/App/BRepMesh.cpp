@@ -25,6 +25,9 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <limits>
+#include <numeric>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #endif
 
@@ -34,37 +37,98 @@
 using namespace Part;
 
 namespace {
-struct MeshVertex
+// Sorts in chunks of a fixed size which are then merged pairwise, so the
+// result doesn't depend on the number of threads
+template<typename Iterator, typename Less>
+void parallelSort(Iterator begin, Iterator end, Less less)
 {
-    Base::Vector3d p;
-    std::size_t i = 0;
-
-    explicit MeshVertex(const Base::Vector3d& p)
-        : p(p)
-    {
+    const std::ptrdiff_t chunkSize = 1 << 15;
+    std::ptrdiff_t size = end - begin;
+    if (size <= chunkSize) {
+        std::sort(begin, end, less);
+        return;
     }
 
-    Base::Vector3d toPoint() const
-    {
-        return p;
+    int numChunks = int((size + chunkSize - 1) / chunkSize);
+    OSD_Parallel::For(0, numChunks, [&](int index) {
+        auto first = begin + index * chunkSize;
+        auto last = begin + std::min(size, (index + 1) * chunkSize);
+        std::sort(first, last, less);
+    });
+
+    for (std::ptrdiff_t width = chunkSize; width < size; width *= 2) {
+        int numMerges = int((size + 2 * width - 1) / (2 * width));
+        OSD_Parallel::For(0, numMerges, [&](int index) {
+            auto first = begin + index * 2 * width;
+            auto middle = begin + std::min(size, index * 2 * width + width);
+            auto last = begin + std::min(size, (index + 1) * 2 * width);
+            std::inplace_merge(first, middle, last, less);
+        });
     }
+}
 
-    bool operator < (const MeshVertex &v) const
-    {
-        if (p.x != v.p.x) {
-            return p.x < v.p.x;
+// Merges the equal points of a single face. The points are numbered in the
+// order they are used by the facets, and facets that collapse are dropped.
+void weldDomain(const BRepMesh::Domain& domain,
+                std::vector<Base::Vector3d>& points,
+                std::vector<BRepMesh::Facet>& faces)
+{
+    const auto& domainPoints = domain.points;
+    std::vector<uint32_t> order(domainPoints.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&domainPoints](uint32_t i1, uint32_t i2) {
+        const Base::Vector3d& p1 = domainPoints[i1];
+        const Base::Vector3d& p2 = domainPoints[i2];
+        if (p1.x != p2.x) {
+            return p1.x < p2.x;
+        }
+        if (p1.y != p2.y) {
+            return p1.y < p2.y;
+        }
+        if (p1.z != p2.z) {
+            return p1.z < p2.z;
         }
-        if (p.y != v.p.y) {
-            return p.y < v.p.y;
+        return i1 < i2;
+    });
+
+    // map every point to the first one with the same coordinates
+    std::vector<uint32_t> representative(domainPoints.size());
+    for (std::size_t i = 0; i < order.size(); i++) {
+        if (i > 0 && domainPoints[order[i]] == domainPoints[order[i - 1]]) {
+            representative[order[i]] = representative[order[i - 1]];
         }
-        if (p.z != v.p.z) {
-            return p.z < v.p.z;
+        else {
+            representative[order[i]] = order[i];
         }
+    }
+
+    const uint32_t unused = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> pointIndex(domainPoints.size(), unused);
+    auto addVertex = [&](uint32_t index) {
+        uint32_t& newIndex = pointIndex[representative[index]];
+        if (newIndex == unused) {
+            newIndex = uint32_t(points.size());
+            points.push_back(domainPoints[index]);
+        }
+        return newIndex;
+    };
 
-        // points are equal
-        return false;
+    points.reserve(domainPoints.size());
+    faces.reserve(domain.facets.size());
+    for (const BRepMesh::Facet& df : domain.facets) {
+        BRepMesh::Facet face;
+        face.I1 = addVertex(df.I1);
+        face.I2 = addVertex(df.I2);
+        face.I3 = addVertex(df.I3);
+
+        // make sure that we don't insert invalid facets
+        if (face.I1 != face.I2 &&
+            face.I2 != face.I3 &&
+            face.I3 != face.I1) {
+            faces.push_back(face);
+        }
     }
-};
+}
 
 class MergeVertex
 {
@@ -100,14 +164,11 @@ public:
         reset();
     }
 
-    std::vector<Base::Vector3d> getPoints() const
+    void swap(std::vector<Base::Vector3d>& points,
+              std::vector<Facet>& faces)
     {
-        return points;
-    }
-
-    std::vector<Facet> getFacets() const
-    {
-        return faces;
+        this->points.swap(points);
+        this->faces.swap(faces);
     }
 
 private:
@@ -163,7 +224,7 @@ private:
             vertices.push_back(it);
         }
 
-        std::sort(vertices.begin(), vertices.end(), vertexLess);
+        parallelSort(vertices.begin(), vertices.end(), vertexLess);
 
         auto next = vertices.begin();
         while (next != vertices.end()) {
@@ -252,59 +313,39 @@ void BRepMesh::getFacesFromDomains(const std::vector<Domain>& domains,
                                    std::vector<Base::Vector3d>& points,
                                    std::vector<Facet>& faces)
 {
+    // the points of a face are only shared within the face, except for those on
+    // its boundary, so each face is welded on its own
+    std::vector<std::vector<Base::Vector3d>> domainPoints(domains.size());
+    std::vector<std::vector<Facet>> domainFaces(domains.size());
+    OSD_Parallel::For(0, int(domains.size()), [&](int index) {
+        weldDomain(domains[index], domainPoints[index], domainFaces[index]);
+    });
+
+    std::size_t numPoints = 0;
     std::size_t numFaces = 0;
-    for (const auto& it : domains) {
-        numFaces += it.facets.size();
-    }
-    faces.reserve(numFaces);
-
-    std::set<MeshVertex> vertices;
-    auto addVertex = [&vertices](const Base::Vector3d& pnt, uint32_t& pointIndex) {
-        MeshVertex vertex(pnt);
-        vertex.i = vertices.size();
-        auto it = vertices.insert(vertex);
-        pointIndex = it.first->i;
-    };
-
-    for (const auto & domain : domains) {
-        std::size_t numDomainFaces = 0;
-        for (const Facet& df : domain.facets) {
-            Facet face;
-
-            // 1st vertex
-            addVertex(domain.points[df.I1], face.I1);
-
-            // 2nd vertex
-            addVertex(domain.points[df.I2], face.I2);
-
-            // 3rd vertex
-            addVertex(domain.points[df.I3], face.I3);
-
-            // make sure that we don't insert invalid facets
-            if (face.I1 != face.I2 &&
-                face.I2 != face.I3 &&
-                face.I3 != face.I1) {
-                faces.push_back(face);
-                numDomainFaces++;
-            }
-        }
-
-        domainSizes.push_back(numDomainFaces);
+    for (std::size_t index = 0; index < domains.size(); index++) {
+        numPoints += domainPoints[index].size();
+        numFaces += domainFaces[index].size();
+        domainSizes.push_back(domainFaces[index].size());
     }
 
     std::vector<Base::Vector3d> meshPoints;
-    meshPoints.resize(vertices.size());
-    for (const auto & vertex : vertices) {
-        meshPoints[vertex.i] = vertex.toPoint();
+    std::vector<Facet> meshFaces;
+    meshPoints.reserve(numPoints);
+    meshFaces.reserve(numFaces);
+    for (std::size_t index = 0; index < domains.size(); index++) {
+        auto offset = uint32_t(meshPoints.size());
+        meshPoints.insert(meshPoints.end(), domainPoints[index].begin(), domainPoints[index].end());
+        for (const auto& face : domainFaces[index]) {
+            meshFaces.push_back({face.I1 + offset, face.I2 + offset, face.I3 + offset});
+        }
     }
-    points.swap(meshPoints);
 
-    MergeVertex merge(points, faces, Precision::Confusion());
-    if (merge.hasDuplicatedPoints()) {
-        merge.mergeDuplicatedPoints();
-        points = merge.getPoints();
-        faces = merge.getFacets();
-    }
+    // the points on the face boundaries are merged with the ones of the
+    // adjacent faces
+    MergeVertex merge(std::move(meshPoints), std::move(meshFaces), Precision::Confusion());
+    merge.mergeDuplicatedPoints();
+    merge.swap(points, faces);
 }
 
 std::vector<BRepMesh::Segment> BRepMesh::createSegments() const
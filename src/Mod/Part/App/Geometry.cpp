@@ -110,10 +110,13 @@
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Writer.h>
 #include <BRep_Tool.hxx>
 #include <TopoDS.hxx>
+#include <algorithm>
 #include <memory>
+#include <sstream>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/thread.hpp>
 
@@ -280,6 +283,37 @@ std::unique_ptr<Geometry> Geometry::fromShape(const TopoDS_Shape &shape, bool si
     return geom;
 }
 
+namespace {
+// Binary helpers shared by the SaveBinary/RestoreBinary implementations below. Placements
+// are stored as full coordinate systems, which is exact unlike the XML AngleXU form.
+void writePoint(Base::OutputStream &str, const gp_Pnt &pnt)
+{
+    str << pnt.X() << pnt.Y() << pnt.Z();
+}
+
+gp_Pnt readPoint(Base::InputStream &str)
+{
+    double x {}, y {}, z {};
+    str >> x >> y >> z;
+    return gp_Pnt(x, y, z);
+}
+
+void writeAxis(Base::OutputStream &str, const gp_Ax2 &axis)
+{
+    writePoint(str, axis.Location());
+    writePoint(str, gp_Pnt(axis.Direction().XYZ()));
+    writePoint(str, gp_Pnt(axis.XDirection().XYZ()));
+}
+
+gp_Ax2 readAxis(Base::InputStream &str)
+{
+    gp_Pnt location = readPoint(str);
+    gp_Pnt normal = readPoint(str);
+    gp_Pnt xdir = readPoint(str);
+    return gp_Ax2(location, gp_Dir(normal.XYZ()), gp_Dir(xdir.XYZ()));
+}
+}
+
 void Geometry::Save(Base::Writer &writer) const
 {
     // We always store an extension array even if empty, so that restoring is consistent.
@@ -348,6 +382,66 @@ void Geometry::Restore(Base::XMLReader &reader)
 
 }
 
+bool Geometry::canSaveBinary() const
+{
+    if (!hasBinaryFormat())
+        return false;
+
+    return std::all_of(extensions.begin(),
+                       extensions.end(),
+                       [](const auto& ext) {
+                           if (!ext->isDerivedFrom(GeometryPersistenceExtension::getClassTypeId()))
+                               return true;
+                           return std::static_pointer_cast<GeometryPersistenceExtension>(ext)->hasBinaryFormat();
+                       });
+}
+
+void Geometry::SaveBinary(Base::OutputStream &str) const
+{
+    std::vector<std::shared_ptr<GeometryPersistenceExtension>> persistent;
+    for(const auto& att : extensions) {
+        if(att->isDerivedFrom(GeometryPersistenceExtension::getClassTypeId()))
+            persistent.push_back(std::static_pointer_cast<GeometryPersistenceExtension>(att));
+    }
+
+    str << static_cast<uint32_t>(persistent.size());
+    for (const auto& ext : persistent) {
+        // Each extension is prefixed with its size so that a reader lacking the extension type
+        // (e.g. a GUI extension in a console session) can skip it.
+        std::ostringstream buffer;
+        Base::OutputStream extStr(buffer);
+        ext->SaveBinary(extStr);
+        std::string data = buffer.str();
+
+        GeometryPersistenceExtension::writeString(str, ext->getTypeId().getName());
+        GeometryPersistenceExtension::writeString(str, data);
+    }
+}
+
+void Geometry::RestoreBinary(Base::InputStream &str)
+{
+    uint32_t count = 0;
+    str >> count;
+
+    for (uint32_t index = 0; index < count; index++) {
+        std::string typeName = GeometryPersistenceExtension::readString(str);
+        std::string data = GeometryPersistenceExtension::readString(str);
+
+        Base::Type type = Base::Type::fromName(typeName.c_str());
+        auto *newExtension = static_cast<GeometryPersistenceExtension *>(type.createInstance());
+        if (newExtension) {
+            std::istringstream buffer(data);
+            Base::InputStream extStr(buffer);
+            newExtension->RestoreBinary(extStr);
+
+            extensions.push_back(std::shared_ptr<GeometryExtension>(newExtension));
+        }
+        else {
+            Base::Console().Warning("Cannot restore geometry extension of type: %s\n", typeName.c_str());
+        }
+    }
+}
+
 boost::uuids::uuid Geometry::getTag() const
 {
     return tag;
@@ -643,6 +737,18 @@ void GeomPoint::Restore(Base::XMLReader &reader)
     setPoint(Base::Vector3d(X,Y,Z) );
 }
 
+void GeomPoint::SaveBinary(Base::OutputStream &str) const
+{
+    Geometry::SaveBinary(str);
+    writePoint(str, myPoint->Pnt());
+}
+
+void GeomPoint::RestoreBinary(Base::InputStream &str)
+{
+    Geometry::RestoreBinary(str);
+    myPoint->SetPnt(readPoint(str));
+}
+
 PyObject *GeomPoint::getPyObject()
 {
     return new PointPy(new GeomPoint(getPoint()));
@@ -2055,6 +2161,66 @@ void GeomBSplineCurve::Restore(Base::XMLReader& reader)
     }
 }
 
+void GeomBSplineCurve::SaveBinary(Base::OutputStream &str) const
+{
+    Geometry::SaveBinary(str);
+
+    const TColgp_Array1OfPnt& poles = myCurve->Poles();
+    const TColStd_Array1OfReal& knots = myCurve->Knots();
+    const TColStd_Array1OfInteger& mults = myCurve->Multiplicities();
+
+    str << static_cast<uint32_t>(poles.Length())
+        << static_cast<uint32_t>(knots.Length())
+        << static_cast<int32_t>(myCurve->Degree())
+        << static_cast<bool>(myCurve->IsPeriodic());
+
+    for (int i = poles.Lower(); i <= poles.Upper(); i++) {
+        writePoint(str, poles(i));
+        str << myCurve->Weight(i);
+    }
+    for (int i = knots.Lower(); i <= knots.Upper(); i++) {
+        str << knots(i) << static_cast<int32_t>(mults(i));
+    }
+}
+
+void GeomBSplineCurve::RestoreBinary(Base::InputStream &str)
+{
+    Geometry::RestoreBinary(str);
+
+    uint32_t polescount = 0;
+    uint32_t knotscount = 0;
+    int32_t degree = 0;
+    bool isperiodic = false;
+    str >> polescount >> knotscount >> degree >> isperiodic;
+
+    TColgp_Array1OfPnt p(1,static_cast<int>(polescount));
+    TColStd_Array1OfReal w(1,static_cast<int>(polescount));
+    TColStd_Array1OfReal k(1,static_cast<int>(knotscount));
+    TColStd_Array1OfInteger m(1,static_cast<int>(knotscount));
+
+    for (int i = 1; i <= static_cast<int>(polescount); i++) {
+        double weight {};
+        p.SetValue(i, readPoint(str));
+        str >> weight;
+        w.SetValue(i, weight);
+    }
+    for (int i = 1; i <= static_cast<int>(knotscount); i++) {
+        double knot {};
+        int32_t mult {};
+        str >> knot >> mult;
+        k.SetValue(i, knot);
+        m.SetValue(i, mult);
+    }
+
+    try {
+        this->myCurve = new Geom_BSplineCurve(p, w, k, m, degree, isperiodic ? Standard_True : Standard_False, Standard_False);
+    }
+    catch (Standard_Failure& e) {
+
+        THROWM(Base::CADKernelError,e.GetMessageString())
+    }
+}
+
 
 PyObject *GeomBSplineCurve::getPyObject()
 {
@@ -2776,6 +2942,29 @@ void GeomCircle::Restore(Base::XMLReader& reader)
     }
 }
 
+void GeomCircle::SaveBinary(Base::OutputStream &str) const
+{
+    Geometry::SaveBinary(str);
+    writeAxis(str, myCurve->Position().Ax2());
+    str << myCurve->Radius();
+}
+
+void GeomCircle::RestoreBinary(Base::InputStream &str)
+{
+    Geometry::RestoreBinary(str);
+    gp_Ax2 axis = readAxis(str);
+    double radius {};
+    str >> radius;
+
+    try {
+        this->myCurve = new Geom_Circle(axis, radius);
+    }
+    catch (Standard_Failure& e) {
+
+        THROWM(Base::CADKernelError,e.GetMessageString())
+    }
+}
+
 PyObject *GeomCircle::getPyObject()
 {
     return new CirclePy(static_cast<GeomCircle*>(this->clone()));
@@ -3036,6 +3225,33 @@ void GeomArcOfCircle::Restore(Base::XMLReader &reader)
     }
 }
 
+void GeomArcOfCircle::SaveBinary(Base::OutputStream &str) const
+{
+    Geometry::SaveBinary(str);
+
+    Handle(Geom_Circle) circle = Handle(Geom_Circle)::DownCast(this->myCurve->BasisCurve());
+    writeAxis(str, circle->Position().Ax2());
+    str << circle->Radius() << myCurve->FirstParameter() << myCurve->LastParameter();
+}
+
+void GeomArcOfCircle::RestoreBinary(Base::InputStream &str)
+{
+    Geometry::RestoreBinary(str);
+    gp_Ax2 axis = readAxis(str);
+    double radius {}, first {}, last {};
+    str >> radius >> first >> last;
+
+    try {
+        Handle(Geom_Circle) circle = Handle(Geom_Circle)::DownCast(this->myCurve->BasisCurve());
+        circle->SetCirc(gp_Circ(axis, radius));
+        this->myCurve->SetTrim(first, last);
+    }
+    catch (Standard_Failure& e) {
+
+        THROWM(Base::CADKernelError,e.GetMessageString())
+    }
+}
+
 PyObject *GeomArcOfCircle::getPyObject()
 {
     return new ArcOfCirclePy(static_cast<GeomArcOfCircle*>(this->clone()));
@@ -3294,6 +3510,29 @@ void GeomEllipse::Restore(Base::XMLReader& reader)
     }
 }
 
+void GeomEllipse::SaveBinary(Base::OutputStream &str) const
+{
+    Geometry::SaveBinary(str);
+    writeAxis(str, myCurve->Position().Ax2());
+    str << myCurve->MajorRadius() << myCurve->MinorRadius();
+}
+
+void GeomEllipse::RestoreBinary(Base::InputStream &str)
+{
+    Geometry::RestoreBinary(str);
+    gp_Ax2 axis = readAxis(str);
+    double major {}, minor {};
+    str >> major >> minor;
+
+    try {
+        this->myCurve = new Geom_Ellipse(axis, major, minor);
+    }
+    catch (Standard_Failure& e) {
+
+        THROWM(Base::CADKernelError,e.GetMessageString())
+    }
+}
+
 PyObject *GeomEllipse::getPyObject()
 {
     return new EllipsePy(static_cast<GeomEllipse*>(this->clone()));
@@ -3589,6 +3828,34 @@ void GeomArcOfEllipse::Restore(Base::XMLReader &reader)
     }
 }
 
+void GeomArcOfEllipse::SaveBinary(Base::OutputStream &str) const
+{
+    Geometry::SaveBinary(str);
+
+    Handle(Geom_Ellipse) ellipse = Handle(Geom_Ellipse)::DownCast(this->myCurve->BasisCurve());
+    writeAxis(str, ellipse->Position().Ax2());
+    str << ellipse->MajorRadius() << ellipse->MinorRadius()
+        << myCurve->FirstParameter() << myCurve->LastParameter();
+}
+
+void GeomArcOfEllipse::RestoreBinary(Base::InputStream &str)
+{
+    Geometry::RestoreBinary(str);
+    gp_Ax2 axis = readAxis(str);
+    double major {}, minor {}, first {}, last {};
+    str >> major >> minor >> first >> last;
+
+    try {
+        Handle(Geom_Ellipse) ellipse = Handle(Geom_Ellipse)::DownCast(this->myCurve->BasisCurve());
+        ellipse->SetElips(gp_Elips(axis, major, minor));
+        this->myCurve->SetTrim(first, last);
+    }
+    catch (Standard_Failure& e) {
+
+        THROWM(Base::CADKernelError,e.GetMessageString())
+    }
+}
+
 PyObject *GeomArcOfEllipse::getPyObject()
 {
     return new ArcOfEllipsePy(static_cast<GeomArcOfEllipse*>(this->clone()));
@@ -4694,6 +4961,24 @@ void GeomLineSegment::Restore    (Base::XMLReader &reader)
     }
 }
 
+void GeomLineSegment::SaveBinary(Base::OutputStream &str) const
+{
+    Geometry::SaveBinary(str);
+
+    Base::Vector3d start = getStartPoint();
+    Base::Vector3d end = getEndPoint();
+    str << start.x << start.y << start.z << end.x << end.y << end.z;
+}
+
+void GeomLineSegment::RestoreBinary(Base::InputStream &str)
+{
+    Geometry::RestoreBinary(str);
+
+    Base::Vector3d start, end;
+    str >> start.x >> start.y >> start.z >> end.x >> end.y >> end.z;
+    setPoints(start, end);
+}
+
 PyObject *GeomLineSegment::getPyObject()
 {
     return new LineSegmentPy(dynamic_cast<GeomLineSegment*>(this->clone()));
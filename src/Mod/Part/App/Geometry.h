@@ -93,6 +93,18 @@ public:
     unsigned int getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
+    /** @name Binary persistence
+     * Compact alternative to Save()/Restore() used by PropertyGeometryList. Only the geometry
+     * types commonly found in sketches override hasBinaryFormat(), a list containing any other
+     * type is saved as XML.
+     */
+    //@{
+    /// true if this geometry and all its persistent extensions have a binary format
+    bool canSaveBinary() const;
+    virtual bool hasBinaryFormat() const {return false;}
+    virtual void SaveBinary(Base::OutputStream &/*str*/) const;
+    virtual void RestoreBinary(Base::InputStream &/*str*/);
+    //@}
     /// returns a copy of this object having a new randomly generated tag. If you also want to copy the tag, you may use clone() instead.
     /// For creation of geometry with other handles, with or without the same tag, you may use the constructors and the sethandle functions.
     /// The tag of a geometry can be copied to another geometry using the assignTag function.
@@ -164,6 +176,9 @@ public:
     unsigned int getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
+    bool hasBinaryFormat() const override {return true;}
+    void SaveBinary(Base::OutputStream &/*str*/) const override;
+    void RestoreBinary(Base::InputStream &/*str*/) override;
     // Base implementer ----------------------------
     PyObject* getPyObject() override;
     /**
@@ -371,6 +386,9 @@ public:
     unsigned int getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
+    bool hasBinaryFormat() const override {return true;}
+    void SaveBinary(Base::OutputStream &/*str*/) const override;
+    void RestoreBinary(Base::InputStream &/*str*/) override;
     // Base implementer ----------------------------
     PyObject *getPyObject() override;
 
@@ -534,6 +552,9 @@ public:
     unsigned int getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
+    bool hasBinaryFormat() const override {return true;}
+    void SaveBinary(Base::OutputStream &/*str*/) const override;
+    void RestoreBinary(Base::InputStream &/*str*/) override;
     // Base implementer ----------------------------
     PyObject *getPyObject() override;
     GeomBSplineCurve* toNurbs(double first, double last) const override;
@@ -569,6 +590,9 @@ public:
     unsigned int getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
+    bool hasBinaryFormat() const override {return true;}
+    void SaveBinary(Base::OutputStream &/*str*/) const override;
+    void RestoreBinary(Base::InputStream &/*str*/) override;
     // Base implementer ----------------------------
     PyObject *getPyObject() override;
     GeomBSplineCurve* toNurbs(double first, double last) const override;
@@ -601,6 +625,9 @@ public:
     unsigned int getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
+    bool hasBinaryFormat() const override {return true;}
+    void SaveBinary(Base::OutputStream &/*str*/) const override;
+    void RestoreBinary(Base::InputStream &/*str*/) override;
     // Base implementer ----------------------------
     PyObject *getPyObject() override;
     GeomBSplineCurve* toNurbs(double first, double last) const override;
@@ -638,6 +665,9 @@ public:
     unsigned int getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
+    bool hasBinaryFormat() const override {return true;}
+    void SaveBinary(Base::OutputStream &/*str*/) const override;
+    void RestoreBinary(Base::InputStream &/*str*/) override;
     // Base implementer ----------------------------
     PyObject *getPyObject() override;
     GeomBSplineCurve* toNurbs(double first, double last) const override;
@@ -822,6 +852,9 @@ public:
     unsigned int getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
+    bool hasBinaryFormat() const override {return true;}
+    void SaveBinary(Base::OutputStream &/*str*/) const override;
+    void RestoreBinary(Base::InputStream &/*str*/) override;
     // Base implementer ----------------------------
     PyObject *getPyObject() override;
 
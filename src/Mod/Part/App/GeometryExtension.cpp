@@ -21,8 +21,13 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+# include <algorithm>
+#endif
 
+#include <Base/Exception.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Writer.h>
 
 #include "GeometryExtension.h"
@@ -89,3 +94,43 @@ bool GeometryPersistenceExtension::isSame(const GeometryPersistenceExtension &ot
     return writer.getString() == writer2.getString();
 }
 
+void GeometryPersistenceExtension::SaveBinary(Base::OutputStream &str) const
+{
+    writeString(str, getName());
+}
+
+void GeometryPersistenceExtension::RestoreBinary(Base::InputStream &str)
+{
+    setName(readString(str));
+}
+
+void GeometryPersistenceExtension::writeString(Base::OutputStream &str, const std::string &value)
+{
+    str << static_cast<uint32_t>(value.size());
+    str.write(value.c_str(), static_cast<int>(value.size()));
+}
+
+std::string GeometryPersistenceExtension::readString(Base::InputStream &str)
+{
+    uint32_t size = 0;
+    str >> size;
+    if (!str) {
+        throw Base::RestoreError("Unexpected end of binary data");
+    }
+
+    // The size comes from the file. Read in chunks so that a corrupt size fails at the end of
+    // the data rather than allocating up to 4 GiB first.
+    const std::size_t chunkSize = 65536;
+    std::string value;
+    value.reserve(std::min<std::size_t>(size, chunkSize));
+    while (value.size() < size) {
+        std::size_t offset = value.size();
+        std::size_t length = std::min<std::size_t>(size - offset, chunkSize);
+        value.resize(offset + length);
+        str.read(&value[offset], static_cast<int>(length));
+        if (!str) {
+            throw Base::RestoreError("Unexpected end of binary data");
+        }
+    }
+    return value;
+}
@@ -30,6 +30,11 @@
 #include <Mod/Part/PartGlobal.h>
 
 
+namespace Base {
+class InputStream;
+class OutputStream;
+}
+
 namespace Part {
 
 class Geometry;
@@ -77,6 +82,20 @@ public:
 
     bool isSame(const GeometryPersistenceExtension &other) const;
 
+    /** @name Binary persistence
+     * Used by PropertyGeometryList when saving geometry to a binary side file.
+     * Extensions not overriding hasBinaryFormat() force the list to be saved as XML.
+     */
+    //@{
+    virtual bool hasBinaryFormat() const {return false;}
+    virtual void SaveBinary(Base::OutputStream &str) const;
+    virtual void RestoreBinary(Base::InputStream &str);
+    //@}
+
+    static void writeString(Base::OutputStream &str, const std::string &value);
+    /// Reads a string written by writeString(), throws Base::RestoreError if the data is truncated
+    static std::string readString(Base::InputStream &str);
+
 protected:
     virtual void restoreAttributes(Base::XMLReader &/*reader*/);
     virtual void saveAttributes(Base::Writer &writer) const;
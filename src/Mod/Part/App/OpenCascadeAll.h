@@ -399,6 +399,7 @@
 #include <Message_MsgFile.hxx>
 #include <NCollection_List.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 
 // Poly*
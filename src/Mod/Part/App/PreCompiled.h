@@ -45,13 +45,18 @@
 #include <ctime>
 
 // STL
+#include <algorithm>
 #include <array>
 #include <fcntl.h>
 #include <fstream>
+#include <future>
 #include <list>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 #include <string>
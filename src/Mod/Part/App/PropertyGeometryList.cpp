@@ -22,8 +22,16 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+# include <algorithm>
+# include <sstream>
+#endif
+
+#include <App/DocumentObject.h>
 #include <Base/Console.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
+#include <Base/Tools.h>
 #include <Base/Writer.h>
 
 #include "PropertyGeometryList.h"
@@ -223,8 +231,24 @@ void PropertyGeometryList::tryRestoreGeometry(Geometry * geom, Base::XMLReader &
     }
 }
 
+bool PropertyGeometryList::canSaveBinary(Base::Writer &writer) const
+{
+    if (!writer.getMode("BinaryGeometry") || writer.isForceXML() || _lValueList.empty())
+        return false;
+
+    return std::all_of(_lValueList.begin(), _lValueList.end(), [](const Geometry* geom) {
+        return geom->canSaveBinary();
+    });
+}
+
 void PropertyGeometryList::Save(Writer &writer) const
 {
+    if (canSaveBinary(writer)) {
+        writer.Stream() << writer.ind() << "<GeometryList count=\"" << getSize()
+                        << "\" file=\"" << writer.addFile(getName(), this) << "\"/>" << endl;
+        return;
+    }
+
     writer.Stream() << writer.ind() << "<GeometryList count=\"" << getSize() <<"\">" << endl;
     writer.incInd();
     for (int i = 0; i < getSize(); i++) {
@@ -254,6 +278,12 @@ void PropertyGeometryList::Restore(Base::XMLReader &reader)
     reader.readElement("GeometryList");
     // get the value of my attribute
     int count = reader.getAttributeAsInteger("count");
+    if (reader.hasAttribute("file")) {
+        // the geometries are stored in a binary file, see SaveDocFile()
+        reader.addFile(reader.getAttribute("file"), this);
+        return;
+    }
+
     std::vector<Geometry*> values;
     values.reserve(count);
     for (int i = 0; i < count; i++) {
@@ -286,6 +316,84 @@ void PropertyGeometryList::Restore(Base::XMLReader &reader)
     setValues(std::move(values));
 }
 
+// Binary format, version 1:
+//   uint32 version, uint32 count,
+//   count x (string type name, string payload written by Geometry::SaveBinary)
+// where strings are stored as a uint32 size followed by the bytes.
+void PropertyGeometryList::SaveDocFile (Base::Writer &writer) const
+{
+    Base::OutputStream str(writer.Stream());
+    str << static_cast<uint32_t>(1) << static_cast<uint32_t>(getSize());
+    for (auto geom : _lValueList) {
+        std::ostringstream buffer;
+        Base::OutputStream geomStr(buffer);
+        geom->SaveBinary(geomStr);
+
+        GeometryPersistenceExtension::writeString(str, geom->getTypeId().getName());
+        GeometryPersistenceExtension::writeString(str, buffer.str());
+    }
+}
+
+void PropertyGeometryList::RestoreDocFile(Base::Reader &reader)
+{
+    Base::InputStream str(reader);
+    uint32_t version = 0;
+    uint32_t count = 0;
+    str >> version >> count;
+    if (version != 1) {
+        Base::Console().Error("PropertyGeometryList: unsupported binary format version %u\n", version);
+        return;
+    }
+
+    std::vector<Geometry*> values;
+    // the count comes from the file, so don't trust it for the allocation
+    values.reserve(std::min<uint32_t>(count, 1024));
+    for (uint32_t i = 0; i < count; i++) {
+        std::string typeName;
+        std::string data;
+        try {
+            typeName = GeometryPersistenceExtension::readString(str);
+            data = GeometryPersistenceExtension::readString(str);
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().Error("PropertyGeometryList: failed to restore geometry %u: %s\n", i, e.what());
+            break;
+        }
+
+        auto newG = static_cast<Geometry *>(Base::Type::fromName(typeName.c_str()).createInstance());
+        if (!newG) {
+            Base::Console().Error("PropertyGeometryList: cannot restore geometry of type %s\n", typeName.c_str());
+            continue;
+        }
+
+        try {
+            std::istringstream buffer(data);
+            Base::InputStream geomStr(buffer);
+            newG->RestoreBinary(geomStr);
+            values.push_back(newG);
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().Error("PropertyGeometryList: failed to restore %s: %s\n", typeName.c_str(), e.what());
+            if (isOrderRelevant())
+                values.push_back(newG);
+            else
+                delete newG;
+        }
+    }
+
+    // The files are read after the owner has left its restoring state. Apply the values under
+    // that state as Restore() does, so that the owner doesn't take them for a user edit.
+    auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
+    if (owner && !owner->isRestoring()) {
+        Base::ObjectStatusLocker<App::ObjectStatus, App::DocumentObject> restoring(
+            App::ObjectStatus::Restore, owner);
+        setValues(std::move(values));
+    }
+    else {
+        setValues(std::move(values));
+    }
+}
+
 App::Property *PropertyGeometryList::Copy() const
 {
     PropertyGeometryList *p = new PropertyGeometryList();
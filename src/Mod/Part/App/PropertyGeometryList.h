@@ -83,6 +83,9 @@ public:
     void Save(Base::Writer &writer) const override;
     void Restore(Base::XMLReader &reader) override;
 
+    void SaveDocFile (Base::Writer &writer) const override;
+    void RestoreDocFile(Base::Reader &reader) override;
+
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
 
@@ -91,6 +94,7 @@ public:
 private:
     void trySaveGeometry(Geometry * geom, Base::Writer &writer) const;
     void tryRestoreGeometry(Geometry * geom, Base::XMLReader &reader);
+    bool canSaveBinary(Base::Writer &writer) const;
 
 private:
     std::vector<Geometry*> _lValueList;
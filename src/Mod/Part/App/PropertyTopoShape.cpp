@@ -271,11 +271,12 @@ void PropertyPartShape::Save (Base::Writer &writer) const
     }
     std::string version;
     // If exporting, do not export mapped element name, but still make a mark
+    std::string restored = getElementMapVersion(true);
     if(owner) {
         if(!owner->isExporting())
-            version = _Ver.size()?_Ver:owner->getElementMapVersion(this);
+            version = restored.size()?restored:owner->getElementMapVersion(this);
     }else
-        version = _Ver.size()?_Ver:_Shape.getElementMapVersion();
+        version = restored.size()?restored:_Shape.getElementMapVersion();
     writer.Stream() << " ElementMap=\"" << version << '"';
 
     bool binary = writer.getMode("BinaryBrep");
@@ -311,8 +312,13 @@ void PropertyPartShape::Save (Base::Writer &writer) const
 }
 
 std::string PropertyPartShape::getElementMapVersion(bool restored) const {
-    if(restored)
+    if(restored) {
+        // The element map is restored on first use, which may be after
+        // afterRestore(). Report a late failure the same way.
+        if(_Ver.size() && _Shape.isRestoreFailed())
+            return "?";
         return _Ver;
+    }
     return PropertyComplexGeoData::getElementMapVersion(false);
 }
 
@@ -412,7 +418,7 @@ void PropertyPartShape::afterRestore()
         // order to try to regenerate the element map
         _Ver = "?";
     }
-    else if (_Shape.getElementMapSize() == 0) {
+    else if (!_Shape.hasPendingElementMap() && _Shape.getElementMapSize() == 0) {
         if (_Shape.Hasher)
             _Shape.Hasher->clear();
     }
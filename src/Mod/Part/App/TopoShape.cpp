@@ -121,6 +121,7 @@
 # include <Law_BSpline.hxx>
 # include <Law_BSpFunc.hxx>
 # include <Law_Constant.hxx>
+# include <OSD_Parallel.hxx>
 # include <ShapeAnalysis_FreeBoundsProperties.hxx>
 # include <ShapeExtend_Explorer.hxx>
 # include <ShapeFix_Shape.hxx>
@@ -3260,50 +3261,47 @@ TopoDS_Shape TopoShape::removeSplitter() const
 
 void TopoShape::getDomains(std::vector<Domain>& domains) const
 {
-    std::size_t countFaces = 0;
+    std::vector<TopoDS_Face> faces;
     for (TopExp_Explorer xp(this->_Shape, TopAbs_FACE); xp.More(); xp.Next()) {
-        ++countFaces;
+        faces.push_back(TopoDS::Face(xp.Current()));
     }
-    domains.reserve(countFaces);
 
-    for (TopExp_Explorer xp(this->_Shape, TopAbs_FACE); xp.More(); xp.Next()) {
-        TopoDS_Face face = TopoDS::Face(xp.Current());
+    // For a face that cannot be meshed the domain stays empty.
+    // It's important for some algorithms (e.g. color mapping) that the numbers of
+    // faces and domains match
+    std::size_t offset = domains.size();
+    domains.resize(offset + faces.size());
 
+    // the triangulations are only read, so the faces can be converted in parallel
+    OSD_Parallel::For(0, static_cast<int>(faces.size()), [&faces, &domains, offset](int index) {
         std::vector<gp_Pnt> points;
         std::vector<Poly_Triangle> facets;
-        if (!Tools::getTriangulation(face, points, facets)) {
-            // For a face that cannot be meshed append an empty domain.
-            // It's important for some algorithms (e.g. color mapping) that the numbers of
-            // faces and domains match
-            Domain domain;
-            domains.push_back(domain);
+        if (!Tools::getTriangulation(faces[index], points, facets)) {
+            return;
         }
-        else {
-            Domain domain;
-            // copy the points
-            domain.points.reserve(points.size());
-            for (const auto& it : points) {
-                Standard_Real X, Y, Z;
-                it.Coord (X, Y, Z);
-                domain.points.emplace_back(X, Y, Z);
-            }
 
-            // copy the triangles
-            domain.facets.reserve(facets.size());
-            for (const auto& it : facets) {
-                Standard_Integer N1, N2, N3;
-                it.Get(N1, N2, N3);
-
-                Facet tria;
-                tria.I1 = N1;
-                tria.I2 = N2;
-                tria.I3 = N3;
-                domain.facets.push_back(tria);
-            }
+        Domain& domain = domains[offset + index];
+        // copy the points
+        domain.points.reserve(points.size());
+        for (const auto& it : points) {
+            Standard_Real X, Y, Z;
+            it.Coord (X, Y, Z);
+            domain.points.emplace_back(X, Y, Z);
+        }
 
-            domains.push_back(domain);
+        // copy the triangles
+        domain.facets.reserve(facets.size());
+        for (const auto& it : facets) {
+            Standard_Integer N1, N2, N3;
+            it.Get(N1, N2, N3);
+
+            Facet tria;
+            tria.I1 = N1;
+            tria.I2 = N2;
+            tria.I3 = N3;
+            domain.facets.push_back(tria);
         }
-    }
+    });
 }
 
 void TopoShape::getFacesFromDomains(const std::vector<Domain>& domains,
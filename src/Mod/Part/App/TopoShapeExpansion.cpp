@@ -79,6 +79,8 @@
 #include <ShapeFix_ShapeTolerance.hxx>
 #include <gp_Pln.hxx>
 
+#include <future>
+#include <mutex>
 #include <utility>
 
 #endif
@@ -280,7 +282,10 @@ void TopoShape::operator=(const TopoShape& sh)
         this->_cache = sh._cache;
         this->_parentCache = sh._parentCache;
         this->_subLocation = sh._subLocation;
-        resetElementMap(sh.elementMap(false));
+        // Copying a freshly restored shape must not force its element map to be parsed
+        if (!sharePendingElementMap(sh)) {
+            resetElementMap(sh.elementMap(false));
+        }
     }
 }
 
@@ -1291,6 +1296,10 @@ struct NameKey
     }
 };
 
+// Number of source elements from which collecting the names of modified and generated
+// elements is split into concurrent passes
+constexpr int elementMapParallelThreshold = 2000;
+
 struct NameInfo
 {
     int index {};
@@ -1440,12 +1449,22 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     std::string postfix;
     Data::MappedName newName;
 
-    std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
+    using NameMap = std::map<Data::IndexedName, std::map<NameKey, NameInfo>>;
+    NameMap newNames;
+
+    FC_TIME_INIT(t);
 
-    // First, collect names from other shapes that generates or modifies the
-    // new shape
-    for (auto& pinfo : infos) {  // Walk Vertexes, then Edges, then Faces
-        auto& info = *pinfo;
+    // The mapper implementations return references to internal buffers and call into OCCT
+    // history, so they are only queried under a lock and the result is copied.
+    std::mutex mapperMutex;
+    auto queryMapper = [&mapper, &mapperMutex](bool generated, const TopoDS_Shape& element) {
+        std::lock_guard<std::mutex> lock(mapperMutex);
+        return generated ? mapper.generated(element) : mapper.modified(element);
+    };
+
+    // Collects the names of the elements of one shape type from other shapes that
+    // generate or modify the new shape.
+    auto collectNames = [&](ShapeInfo& info, NameMap& names) {
         for (const auto& incomingShape : shapes) {
             if (!canMapElement(incomingShape)) {
                 continue;
@@ -1465,7 +1484,7 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                                                 &sids));
 
                 int newShapeCounter = 0;
-                for (auto& newShape : mapper.modified(otherElement)) {
+                for (auto& newShape : queryMapper(false, otherElement)) {
                     ++newShapeCounter;
                     if (newShape.ShapeType() >= TopAbs_SHAPE) {
                         // NOLINTNEXTLINE
@@ -1506,7 +1525,7 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                     }
 
                     key.tag = incomingShape.Tag;
-                    auto& name_info = newNames[element][key];
+                    auto& name_info = names[element][key];
                     name_info.sids = sids;
                     name_info.index = newShapeCounter;
                     name_info.shapetype = info.shapetype;
@@ -1518,7 +1537,7 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                 // Find all new objects that were generated from an old object
                 // (e.g. a face generated from an edge)
                 newShapeCounter = 0;
-                for (auto& newShape : mapper.generated(otherElement)) {
+                for (auto& newShape : queryMapper(true, otherElement)) {
                     if (newShape.ShapeType() >= TopAbs_SHAPE) {
                         // NOLINTNEXTLINE
                         FC_ERR("unknown generated shape type " << newShape.ShapeType() << " from "
@@ -1588,7 +1607,7 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                         }
 
                         key.tag = incomingShape.Tag;
-                        auto& name_info = newNames[element][key];
+                        auto& name_info = names[element][key];
                         name_info.sids = sids;
                         if (newShapeCounter == parallelFace) {
                             name_info.index = std::numeric_limits<int>::min();
@@ -1605,6 +1624,51 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                 }
             }
         }
+    };
+
+    // First, collect names from other shapes that generates or modifies the new shape. The
+    // vertex, edge and face passes only read the shapes and their caches, so they may run
+    // concurrently once the lazily built caches are initialized. Flushing also restores any
+    // pending element map, so the passes never reach the string hasher; new IDs are only
+    // obtained by the sequential naming below. Each pass fills its own map, and the keys of
+    // different passes never collide because NameKey::shapetype encodes the pass, so merging
+    // them gives the same result as running them in sequence.
+    int elementCount = 0;
+    flushElementMap();
+    for (const auto& incomingShape : shapes) {
+        if (!canMapElement(incomingShape)) {
+            continue;
+        }
+        incomingShape.flushElementMap();
+        for (auto& pinfo : infos) {
+            elementCount += incomingShape._cache->getAncestry(pinfo->type).count();
+        }
+    }
+
+    std::array<NameMap, 3> passNames;
+    if (elementCount >= elementMapParallelThreshold) {
+        std::array<std::future<void>, 3> passes;
+        for (std::size_t pass = 0; pass < infos.size(); ++pass) {
+            passes[pass] = std::async(std::launch::async, [&, pass]() {
+                collectNames(*infos[pass], passNames[pass]);
+            });
+        }
+        for (auto& pass : passes) {
+            pass.get();
+        }
+    }
+    else {
+        for (std::size_t pass = 0; pass < infos.size(); ++pass) {
+            collectNames(*infos[pass], passNames[pass]);
+        }
+    }
+    for (auto& names : passNames) {  // Vertexes, then Edges, then Faces
+        for (auto& [element, keys] : names) {
+            auto& target = newNames[element];
+            for (auto& [key, info] : keys) {
+                target[key] = std::move(info);
+            }
+        }
     }
 
     // We shall first exclude those names generated from high level mapping. If
@@ -1950,6 +2014,9 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
         }
         delayed = true;
     }
+
+    FC_TIME_LOG(t, "element map " << op << " tag " << Tag << " (" << elementCount
+                                  << " source elements)");
     return *this;
 }
 
@@ -68,6 +68,7 @@
 
 #include <App/PropertyStandard.h>
 #include <App/StringHasherPy.h>
+#include <Base/ArrayViewPy.h>
 #include <Base/FileInfo.h>
 #include <Base/GeometryPyCXX.h>
 #include <Base/MatrixPy.h>
@@ -1567,6 +1568,60 @@ PyObject* TopoShapePy::tessellate(PyObject *args)
     }
 }
 
+PyObject* TopoShapePy::tessellateBuffers(PyObject *args)
+{
+    double tolerance;
+    PyObject* ok = Py_False;
+    if (!PyArg_ParseTuple(args, "d|O!", &tolerance, &PyBool_Type, &ok))
+        return nullptr;
+
+    static_assert(sizeof(Base::Vector3d) == 3 * sizeof(double),
+                  "Vertices are not stored as contiguous triples");
+    static_assert(sizeof(Data::ComplexGeoData::Facet) == 3 * sizeof(uint32_t),
+                  "Facets are not stored as contiguous triples");
+    static_assert(sizeof(uint32_t) == sizeof(unsigned int),
+                  "Format of the face indices doesn't match");
+
+    try {
+        // the views own the arrays, so they stay valid whatever happens to the shape
+        auto Points = std::make_shared<std::vector<Base::Vector3d>>();
+        auto Facets = std::make_shared<std::vector<Data::ComplexGeoData::Facet>>();
+        if (Base::asBoolean(ok))
+            BRepTools::Clean(getTopoShapePtr()->getShape());
+        getTopoShapePtr()->getFaces(*Points, *Facets,tolerance);
+
+        Base::ArrayViewPy::Layout vertex;
+        vertex.data = Points->empty() ? nullptr : &Points->front().x;
+        vertex.format = "d";
+        vertex.itemSize = sizeof(double);
+        vertex.rows = static_cast<Py_ssize_t>(Points->size());
+        vertex.columns = 3;
+        vertex.rowStride = sizeof(Base::Vector3d);
+
+        Base::ArrayViewPy::Layout facet;
+        facet.data = Facets->empty() ? nullptr : &Facets->front().I1;
+        facet.format = "I";
+        facet.itemSize = sizeof(uint32_t);
+        facet.rows = static_cast<Py_ssize_t>(Facets->size());
+        facet.columns = 3;
+        facet.rowStride = sizeof(Data::ComplexGeoData::Facet);
+
+        PyObject* vertexView = Base::ArrayViewPy::create(vertex, nullptr, Points);
+        if (!vertexView)
+            return nullptr;
+        PyObject* facetView = Base::ArrayViewPy::create(facet, nullptr, Facets);
+        if (!facetView) {
+            Py_DECREF(vertexView);
+            return nullptr;
+        }
+        return Py_BuildValue("(NN)", vertexView, facetView);
+    }
+    catch (Standard_Failure& e) {
+        PyErr_SetString(PartExceptionOCCError, e.GetMessageString());
+        return nullptr;
+    }
+}
+
 PyObject* TopoShapePy::project(PyObject *args)
 {
     PyObject *obj;
@@ -37,12 +37,19 @@
 # include <Inventor/SoPrimitiveVertex.h>
 # include <Inventor/actions/SoGetBoundingBoxAction.h>
 # include <Inventor/actions/SoGLRenderAction.h>
+# include <Inventor/actions/SoRayPickAction.h>
 # include <Inventor/bundles/SoMaterialBundle.h>
 # include <Inventor/details/SoLineDetail.h>
+# include <Inventor/details/SoPointDetail.h>
 # include <Inventor/elements/SoCoordinateElement.h>
 # include <Inventor/elements/SoGLCoordinateElement.h>
 # include <Inventor/elements/SoLineWidthElement.h>
+# include <Inventor/elements/SoMaterialBindingElement.h>
+# include <Inventor/elements/SoNormalElement.h>
+# include <Inventor/elements/SoPickStyleElement.h>
+# include <Inventor/elements/SoTextureEnabledElement.h>
 # include <Inventor/errors/SoDebugError.h>
+# include <Inventor/misc/SoNotification.h>
 # include <Inventor/misc/SoState.h>
 #endif
 
@@ -465,3 +472,113 @@ SoDetail * SoBrepEdgeSet::createLineSegmentDetail(SoRayPickAction * action,
     return detail;
 }
 
+void SoBrepEdgeSet::notify(SoNotList * list)
+{
+    SoField *field = list->getLastField();
+    if (field == &this->coordIndex || field == &this->vertexProperty) {
+        pickCache.invalidate();
+    }
+    inherited::notify(list);
+}
+
+bool SoBrepEdgeSet::updatePickCache(SoState *state)
+{
+    // Only the plain polylines created by ViewProviderPartExt are handled,
+    // so that the pick details can be filled in without generating primitives.
+    if (this->vertexProperty.getValue())
+        return false;
+    if (SoNormalElement::getInstance(state)->getNum() > 0 || SoTextureEnabledElement::get(state))
+        return false;
+    auto mbind = SoMaterialBindingElement::get(state);
+    if (mbind != SoMaterialBindingElement::OVERALL && mbind != SoMaterialBindingElement::PER_FACE)
+        return false;
+
+    const SoCoordinateElement *coords = SoCoordinateElement::getInstance(state);
+    if (!coords->is3D())
+        return false;
+
+    uint32_t coordId = coords->getNodeId();
+    if (pickCache.isValid(coordId))
+        return pickCache.isSupported();
+
+    const SbVec3f *coords3d = coords->getArrayPtr3();
+    const int32_t numcoords = coords->getNum();
+    const int32_t *cindices = this->coordIndex.getValues(0);
+    const int32_t numindices = this->coordIndex.getNum();
+
+    pickSegments.clear();
+    std::vector<SbBox3f> boxes;
+    int32_t line = 0;
+    int32_t prev = -1;
+    for (int32_t i = 0; i < numindices; ++i) {
+        int32_t v = cindices[i];
+        if (v >= numcoords || (v < 0 && prev < 0)) {
+            pickSegments.clear();
+            pickCache.setUnsupported(coordId);
+            return false;
+        }
+        if (v < 0) {
+            ++line;
+        }
+        else if (prev >= 0) {
+            pickSegments.push_back({prev, v, line});
+            SbBox3f box;
+            box.extendBy(coords3d[prev]);
+            box.extendBy(coords3d[v]);
+            boxes.push_back(box);
+        }
+        prev = v;
+    }
+    pickCache.build(coordId, boxes);
+    return true;
+}
+
+void SoBrepEdgeSet::rayPick(SoRayPickAction * action)
+{
+    SoState *state = action->getState();
+    // bounding box picking and unpickable nodes are handled by SoShape
+    if (SoPickStyleElement::get(state) != SoPickStyleElement::SHAPE
+            || !updatePickCache(state)) {
+        inherited::rayPick(action);
+        return;
+    }
+    if (!this->shouldRayPick(action))
+        return;
+
+    this->computeObjectSpaceRay(action);
+    pickCache.findCandidates(action, pickCandidates);
+    if (pickCandidates.empty())
+        return;
+
+    const SbVec3f *coords3d = SoCoordinateElement::getInstance(state)->getArrayPtr3();
+    bool perLine = SoMaterialBindingElement::get(state) == SoMaterialBindingElement::PER_FACE;
+
+    // same as the line segment picking of SoShape, with the details set up
+    // as createLineSegmentDetail() does
+    for (int32_t index : pickCandidates) {
+        const PickSegment &segment = pickSegments[index];
+        SbVec3f intersection;
+        if (!action->intersect(coords3d[segment.v1], coords3d[segment.v2], intersection)
+                || !action->isBetweenPlanes(intersection))
+            continue;
+
+        SoPickedPoint *pp = action->addIntersection(intersection);
+        if (!pp)
+            continue;
+
+        int32_t matIndex = perLine ? segment.line : 0;
+        SoPointDetail pointDetail;
+        pointDetail.setMaterialIndex(matIndex);
+        auto detail = new SoLineDetail;
+        pointDetail.setCoordinateIndex(segment.v1);
+        detail->setPoint0(&pointDetail);
+        pointDetail.setCoordinateIndex(segment.v2);
+        detail->setPoint1(&pointDetail);
+        detail->setLineIndex(segment.line);
+        detail->setPartIndex(segment.line);
+
+        pp->setDetail(detail, this);
+        pp->setMaterialIndex(matIndex);
+        pp->setObjectNormal(SbVec3f(0.0f, 0.0f, 1.0f));
+    }
+}
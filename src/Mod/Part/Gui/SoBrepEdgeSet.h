@@ -29,6 +29,8 @@
 #include <Gui/SoFCSelectionContext.h>
 #include <Mod/Part/PartGlobal.h>
 
+#include "SoBrepPickCache.h"
+
 
 class SoCoordinateElement;
 class SoGLCoordinateElement;
@@ -57,6 +59,8 @@ protected:
         SoPickedPoint *pp) override;
 
     void getBoundingBox(SoGetBoundingBoxAction * action) override;
+    void rayPick(SoRayPickAction * action) override;
+    void notify(SoNotList * list) override;
 
 private:
     struct SelContext;
@@ -67,12 +71,22 @@ private:
     void renderHighlight(SoGLRenderAction *action, SelContextPtr);
     void renderSelection(SoGLRenderAction *action, SelContextPtr, bool push=true);
     bool validIndexes(const SoCoordinateElement*, const std::vector<int32_t>&) const;
+    bool updatePickCache(SoState *state);
 
 private:
     SelContextPtr selContext;
     SelContextPtr selContext2;
     Gui::SoFCSelectionCounter selCounter;
     uint32_t packedColor{0};
+
+    struct PickSegment {
+        int32_t v1;
+        int32_t v2;
+        int32_t line;
+    };
+    SoBrepPickCache pickCache;
+    std::vector<PickSegment> pickSegments;
+    std::vector<int32_t> pickCandidates;
 };
 
 } // namespace PartGui
@@ -36,6 +36,7 @@
 # include <Inventor/SoPrimitiveVertex.h>
 # include <Inventor/actions/SoGetBoundingBoxAction.h>
 # include <Inventor/actions/SoGLRenderAction.h>
+# include <Inventor/actions/SoRayPickAction.h>
 # include <Inventor/bundles/SoMaterialBundle.h>
 # include <Inventor/bundles/SoTextureCoordinateBundle.h>
 # include <Inventor/elements/SoLazyElement.h>
@@ -44,10 +45,12 @@
 # include <Inventor/elements/SoGLCoordinateElement.h>
 # include <Inventor/elements/SoGLCacheContextElement.h>
 # include <Inventor/elements/SoGLVBOElement.h>
+# include <Inventor/elements/SoPickStyleElement.h>
 # include <Inventor/errors/SoDebugError.h>
 # include <Inventor/details/SoFaceDetail.h>
 # include <Inventor/misc/SoState.h>
 # include <Inventor/misc/SoContextHandler.h>
+# include <Inventor/misc/SoNotification.h>
 # include <Inventor/elements/SoCacheElement.h>
 # include <Inventor/elements/SoTextureEnabledElement.h>
 
@@ -1060,6 +1063,66 @@ void SoBrepFaceSet::generatePrimitives(SoAction * action)
             mindices++;
     }
 
+    // When ray picking through the pick cache only the candidate triangles are
+    // generated. The other ones just advance the indices, so that the details
+    // of a picked triangle are the same as without the cache.
+    const int32_t *candidate = nullptr;
+    const int32_t *candidateEnd = nullptr;
+    if (pickFiltered) {
+        candidate = pickCandidates.data();
+        candidateEnd = candidate + pickCandidates.size();
+    }
+
+    auto skipVertex = [&](bool first) {
+        if (first && (mbind == PER_PART || mbind == PER_PART_INDEXED)) {
+            if (trinr == 0) {
+                if (mbind == PER_PART)
+                    matnr++;
+                else
+                    mindices++;
+            }
+        }
+        else if (mbind == PER_VERTEX || (first && mbind == PER_FACE))
+            matnr++;
+        else if (mbind == PER_VERTEX_INDEXED || (first && mbind == PER_FACE_INDEXED))
+            mindices++;
+        if (nbind == PER_VERTEX || (first && nbind == PER_FACE))
+            normnr++;
+        else if (nbind == PER_VERTEX_INDEXED || (first && nbind == PER_FACE_INDEXED))
+            nindices++;
+        if ((tb.isFunction() && tb.needIndices()) || (!tb.isFunction() && tbind != NONE)) {
+            if (tindices)
+                tindices++;
+            else
+                texidx++;
+        }
+    };
+
+    auto nextFace = [&]() {
+        faceDetail.incFaceIndex();
+        if (mbind == PER_VERTEX_INDEXED) {
+            mindices++;
+        }
+        if (nbind == PER_VERTEX_INDEXED) {
+            nindices++;
+        }
+        if (tindices) tindices++;
+
+        trinr++;
+        if (pi == trinr) {
+            pi = piptr < piendptr ? *piptr++ : -1;
+            while (pi == 0) {
+                // It may happen that a part has no triangles
+                pi = piptr < piendptr ? *piptr++ : -1;
+                if (mbind == PER_PART)
+                    matnr++;
+                else if (mbind == PER_PART_INDEXED)
+                    mindices++;
+            }
+            trinr = 0;
+        }
+    };
+
     while (viptr + 2 < viendptr) {
         v1 = *viptr++;
         v2 = *viptr++;
@@ -1074,6 +1137,19 @@ void SoBrepFaceSet::generatePrimitives(SoAction * action)
             if (v5 < 0) newmode = QUADS;
             else newmode = POLYGON;
         }
+        if (candidate) {
+            // the pick cache is only used for plain triangles
+            if (candidate == candidateEnd)
+                break;
+            if (*candidate != faceDetail.getFaceIndex()) {
+                skipVertex(true);
+                skipVertex(false);
+                skipVertex(false);
+                nextFace();
+                continue;
+            }
+            ++candidate;
+        }
         if (newmode != mode) {
             if (mode != POLYGON) this->endShape();
             mode = newmode;
@@ -1140,28 +1216,7 @@ void SoBrepFaceSet::generatePrimitives(SoAction * action)
                 this->endShape();
             }
         }
-        faceDetail.incFaceIndex();
-        if (mbind == PER_VERTEX_INDEXED) {
-            mindices++;
-        }
-        if (nbind == PER_VERTEX_INDEXED) {
-            nindices++;
-        }
-        if (tindices) tindices++;
-
-        trinr++;
-        if (pi == trinr) {
-            pi = piptr < piendptr ? *piptr++ : -1;
-            while (pi == 0) {
-                // It may happen that a part has no triangles
-                pi = piptr < piendptr ? *piptr++ : -1;
-                if (mbind == PER_PART)
-                    matnr++;
-                else if (mbind == PER_PART_INDEXED)
-                    mindices++;
-            }
-            trinr = 0;
-        }
+        nextFace();
     }
     if (mode != POLYGON) this->endShape();
 
@@ -1176,6 +1231,79 @@ void SoBrepFaceSet::generatePrimitives(SoAction * action)
 
 #undef DO_VERTEX
 
+void SoBrepFaceSet::notify(SoNotList * list)
+{
+    SoField *field = list->getLastField();
+    if (field == &this->coordIndex || field == &this->vertexProperty) {
+        pickCache.invalidate();
+    }
+    inherited::notify(list);
+}
+
+bool SoBrepFaceSet::updatePickCache(SoState *state)
+{
+    if (this->vertexProperty.getValue())
+        return false;
+
+    const SoCoordinateElement *coords = SoCoordinateElement::getInstance(state);
+    if (!coords->is3D())
+        return false;
+
+    uint32_t coordId = coords->getNodeId();
+    if (pickCache.isValid(coordId))
+        return pickCache.isSupported();
+
+    // only plain triangles are handled, which is what ViewProviderPartExt creates
+    const SbVec3f *coords3d = coords->getArrayPtr3();
+    const int32_t numcoords = coords->getNum();
+    const int32_t *cindices = this->coordIndex.getValues(0);
+    const int32_t numindices = this->coordIndex.getNum();
+
+    std::vector<SbBox3f> boxes;
+    boxes.reserve(numindices / 4);
+    for (int32_t i = 0; i + 2 < numindices; i += 4) {
+        int32_t v1 = cindices[i];
+        int32_t v2 = cindices[i+1];
+        int32_t v3 = cindices[i+2];
+        if (v1 < 0 || v2 < 0 || v3 < 0) {
+            break;
+        }
+        if (v1 >= numcoords || v2 >= numcoords || v3 >= numcoords
+                || (i + 3 < numindices && cindices[i+3] >= 0)) {
+            pickCache.setUnsupported(coordId);
+            return false;
+        }
+        SbBox3f box;
+        box.extendBy(coords3d[v1]);
+        box.extendBy(coords3d[v2]);
+        box.extendBy(coords3d[v3]);
+        boxes.push_back(box);
+    }
+    pickCache.build(coordId, boxes);
+    return true;
+}
+
+void SoBrepFaceSet::rayPick(SoRayPickAction * action)
+{
+    // bounding box picking and unpickable nodes are handled by SoShape
+    if (SoPickStyleElement::get(action->getState()) != SoPickStyleElement::SHAPE
+            || !updatePickCache(action->getState())) {
+        inherited::rayPick(action);
+        return;
+    }
+    if (!this->shouldRayPick(action))
+        return;
+
+    this->computeObjectSpaceRay(action);
+    pickCache.findCandidates(action, pickCandidates);
+    if (pickCandidates.empty())
+        return;
+
+    pickFiltered = true;
+    this->generatePrimitives(action);
+    pickFiltered = false;
+}
+
 void SoBrepFaceSet::renderHighlight(SoGLRenderAction *action, SelContextPtr ctx)
 {
     if(!ctx || ctx->highlightIndex < 0)
@@ -31,6 +31,8 @@
 #include <Gui/SoFCSelectionContext.h>
 #include <Mod/Part/PartGlobal.h>
 
+#include "SoBrepPickCache.h"
+
 
 class SoGLCoordinateElement;
 class SoTextureCoordinateBundle;
@@ -95,6 +97,8 @@ protected:
         SoPickedPoint * pp) override;
     void generatePrimitives(SoAction * action) override;
     void getBoundingBox(SoGetBoundingBoxAction * action) override;
+    void rayPick(SoRayPickAction * action) override;
+    void notify(SoNotList * list) override;
 
 private:
     enum Binding {
@@ -134,6 +138,8 @@ private:
 
     bool overrideMaterialBinding(SoGLRenderAction *action, SelContextPtr ctx, SelContextPtr ctx2);
 
+    bool updatePickCache(SoState *state);
+
 #ifdef RENDER_GLARRAYS
     void renderSimpleArray();
     void renderColoredArray(SoMaterialBundle *const materials);
@@ -151,6 +157,12 @@ private:
     uint32_t packedColor;
     Gui::SoFCSelectionCounter selCounter;
 
+    // triangles near the pick ray, generatePrimitives() only handles these
+    // while pickFiltered is set
+    SoBrepPickCache pickCache;
+    std::vector<int32_t> pickCandidates;
+    bool pickFiltered = false;
+
     // Define some VBO pointer for the current mesh
     class VBO;
     std::unique_ptr<VBO> pimpl;
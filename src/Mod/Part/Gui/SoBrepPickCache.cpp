@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <numeric>
+# include <Inventor/actions/SoRayPickAction.h>
+#endif
+
+#include "SoBrepPickCache.h"
+
+
+using namespace PartGui;
+
+namespace {
+// maximum number of primitives in a leaf node
+const int32_t LeafSize = 8;
+}
+
+void SoBrepPickCache::build(uint32_t coordNodeId, const std::vector<SbBox3f>& boxes)
+{
+    nodes.clear();
+    primitives.resize(boxes.size());
+    std::iota(primitives.begin(), primitives.end(), 0);
+
+    std::vector<SbVec3f> centers;
+    centers.reserve(boxes.size());
+    for (const auto& box : boxes) {
+        centers.push_back(box.getCenter());
+    }
+
+    if (!boxes.empty()) {
+        nodes.reserve(2 * boxes.size() / LeafSize + 1);
+        buildNode(boxes, centers, 0, static_cast<int32_t>(boxes.size()));
+    }
+
+    nodeId = coordNodeId;
+    valid = true;
+    supported = true;
+}
+
+void SoBrepPickCache::setUnsupported(uint32_t coordNodeId)
+{
+    nodes.clear();
+    primitives.clear();
+    nodeId = coordNodeId;
+    valid = true;
+    supported = false;
+}
+
+int32_t SoBrepPickCache::buildNode(const std::vector<SbBox3f>& boxes,
+                                   const std::vector<SbVec3f>& centers,
+                                   int32_t first,
+                                   int32_t count)
+{
+    auto index = static_cast<int32_t>(nodes.size());
+    nodes.emplace_back();
+
+    SbBox3f box;
+    SbBox3f centerBox;
+    for (int32_t i = first; i < first + count; ++i) {
+        box.extendBy(boxes[primitives[i]]);
+        centerBox.extendBy(centers[primitives[i]]);
+    }
+    nodes[index].box = box;
+
+    if (count <= LeafSize) {
+        nodes[index].first = first;
+        nodes[index].count = count;
+        return index;
+    }
+
+    // split at the median of the primitive centers along the longest axis
+    float dx, dy, dz;
+    centerBox.getSize(dx, dy, dz);
+    int axis = (dx >= dy && dx >= dz) ? 0 : (dy >= dz ? 1 : 2);
+    int32_t half = count / 2;
+    auto begin = primitives.begin() + first;
+    std::nth_element(begin, begin + half, begin + count, [&centers, axis](int32_t a, int32_t b) {
+        return centers[a][axis] < centers[b][axis];
+    });
+
+    buildNode(boxes, centers, first, half);
+    int32_t second = buildNode(boxes, centers, first + half, count - half);
+    nodes[index].second = second;
+    return index;
+}
+
+void SoBrepPickCache::findCandidates(SoRayPickAction* action, std::vector<int32_t>& candidates) const
+{
+    candidates.clear();
+    if (nodes.empty()) {
+        return;
+    }
+
+    std::vector<int32_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        int32_t index = stack.back();
+        stack.pop_back();
+        const Node& node = nodes[index];
+        // test against the whole pick volume, so that the pick radius used
+        // for lines is taken into account
+        if (!action->intersect(node.box, TRUE)) {
+            continue;
+        }
+        if (node.count > 0) {
+            auto begin = primitives.begin() + node.first;
+            candidates.insert(candidates.end(), begin, begin + node.count);
+        }
+        else {
+            stack.push_back(node.second);
+            stack.push_back(index + 1);
+        }
+    }
+
+    // the owner generates the candidates in the order of its primitives
+    std::sort(candidates.begin(), candidates.end());
+}
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef PARTGUI_SOBREPPICKCACHE_H
+#define PARTGUI_SOBREPPICKCACHE_H
+
+#include <cstdint>
+#include <vector>
+#include <Inventor/SbBox3f.h>
+#include <Inventor/SbVec3f.h>
+#include <Mod/Part/PartGlobal.h>
+
+class SoRayPickAction;
+
+namespace PartGui {
+
+/**
+ * A bounding volume hierarchy over the primitives (triangles, line segments)
+ * of one of the SoBrep nodes. It is used in ray picking to find the few
+ * primitives close to the pick ray instead of testing all of them.
+ *
+ * The cache is keyed by the node id of the coordinate node it was built for,
+ * the owning node has to call invalidate() when its indices change.
+ */
+class PartGuiExport SoBrepPickCache
+{
+public:
+    /// Returns true if the cache was built, or found unsupported, for the given coordinates
+    bool isValid(uint32_t coordNodeId) const
+    {
+        return valid && nodeId == coordNodeId;
+    }
+    /// Returns true if the primitives can be picked through the cache
+    bool isSupported() const
+    {
+        return supported;
+    }
+    void invalidate()
+    {
+        valid = false;
+    }
+
+    /// Builds the hierarchy from one bounding box per primitive
+    void build(uint32_t coordNodeId, const std::vector<SbBox3f>& boxes);
+    /// Marks the primitives as not supported, the owner picks them the usual way
+    void setUnsupported(uint32_t coordNodeId);
+
+    /** Finds the primitives whose bounding box intersects the pick volume
+     *
+     * @param action: the pick action, computeObjectSpaceRay() must have been
+     * called on the owning node.
+     * @param candidates: receives the primitive indices in ascending order
+     */
+    void findCandidates(SoRayPickAction* action, std::vector<int32_t>& candidates) const;
+
+private:
+    struct Node
+    {
+        SbBox3f box;
+        // leaf nodes refer to count primitives starting at first, inner nodes
+        // have count 0, their first child follows them and second is the other one
+        int32_t first = 0;
+        int32_t count = 0;
+        int32_t second = 0;
+    };
+
+    int32_t buildNode(const std::vector<SbBox3f>& boxes,
+                      const std::vector<SbVec3f>& centers,
+                      int32_t first,
+                      int32_t count);
+
+    std::vector<Node> nodes;
+    std::vector<int32_t> primitives;
+    uint32_t nodeId = 0;
+    bool valid = false;
+    bool supported = false;
+};
+
+} // namespace PartGui
+
+#endif // PARTGUI_SOBREPPICKCACHE_H
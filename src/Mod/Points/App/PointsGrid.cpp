@@ -21,12 +21,56 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <QtConcurrentMap>
+#endif
 
 #include "PointsGrid.h"
 
 
 using namespace Points;
 
+namespace
+{
+// Interleaves the lower 21 bits of v with two zero bits each
+std::uint64_t spreadBits(std::uint64_t v)
+{
+    v &= 0x1fffff;
+    v = (v | (v << 32)) & 0x1f00000000ffff;
+    v = (v | (v << 16)) & 0x1f0000ff0000ff;
+    v = (v | (v << 8)) & 0x100f00f00f00f00f;
+    v = (v | (v << 4)) & 0x10c30c30c30c30c3;
+    v = (v | (v << 2)) & 0x1249249249249249;
+    return v;
+}
+
+std::uint64_t mortonCode(unsigned long ulX, unsigned long ulY, unsigned long ulZ)
+{
+    return spreadBits(ulX) | (spreadBits(ulY) << 1) | (spreadBits(ulZ) << 2);
+}
+
+// Number of query points that are processed by one task
+const std::size_t BlockSize = 512;
+
+// Splits the range [0, count) into blocks that are processed in parallel
+template<typename Func>
+void forEachBlock(std::size_t count, Func&& func)
+{
+    std::vector<std::size_t> blocks;
+    blocks.reserve(count / BlockSize + 1);
+    for (std::size_t first = 0; first < count; first += BlockSize) {
+        blocks.push_back(first);
+    }
+    QtConcurrent::blockingMap(blocks, [&func, count](const std::size_t& first) {
+        func(first, std::min(first + BlockSize, count));
+    });
+}
+}  // namespace
+
 PointsGrid::PointsGrid(const PointKernel& rclM)
     : _pclPoints(&rclM)
     , _ulCtElements(0)
@@ -122,7 +166,9 @@ void PointsGrid::Attach(const PointKernel& rclM)
 
 void PointsGrid::Clear()
 {
-    _aulGrid.clear();
+    _aulPoints.clear();
+    _aclPoints.clear();
+    _aulCells.clear();
     _pclPoints = nullptr;
 }
 
@@ -202,14 +248,9 @@ void PointsGrid::InitGrid()
     }
 
     // Create data structure
-    _aulGrid.clear();
-    _aulGrid.resize(_ulCtGridsX);
-    for (unsigned long i = 0; i < _ulCtGridsX; i++) {
-        _aulGrid[i].resize(_ulCtGridsY);
-        for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-            _aulGrid[i][j].resize(_ulCtGridsZ);
-        }
-    }
+    _aulPoints.clear();
+    _aclPoints.clear();
+    _aulCells.assign(_ulCtGridsX * _ulCtGridsY * _ulCtGridsZ, std::make_pair(0UL, 0UL));
 }
 
 unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
@@ -232,9 +273,7 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(raulElements.end(),
-                                    _aulGrid[i][j][k].begin(),
-                                    _aulGrid[i][j][k].end());
+                AppendElements(i, j, k, raulElements);
             }
         }
     }
@@ -270,9 +309,7 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
-                    raulElements.insert(raulElements.end(),
-                                        _aulGrid[i][j][k].begin(),
-                                        _aulGrid[i][j][k].end());
+                    AppendElements(i, j, k, raulElements);
                 }
             }
         }
@@ -303,7 +340,7 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                GetElements(i, j, k, raulElements);
             }
         }
     }
@@ -552,7 +589,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            GetElements(nX, i, j, raclInd);
                         }
                     }
                     nX++;
@@ -564,7 +601,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            GetElements(nX, i, j, raclInd);
                         }
                     }
                     nX++;
@@ -576,7 +613,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            GetElements(i, nY, j, raclInd);
                         }
                     }
                     nY++;
@@ -588,7 +625,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            GetElements(i, nY, j, raclInd);
                         }
                     }
                     nY--;
@@ -600,7 +637,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            raclInd.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            GetElements(i, j, nZ, raclInd);
                         }
                     }
                     nZ++;
@@ -612,7 +649,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            raclInd.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            GetElements(i, j, nZ, raclInd);
                         }
                     }
                     nZ--;
@@ -682,22 +719,24 @@ unsigned long PointsGrid::GetElements(unsigned long ulX,
                                       unsigned long ulZ,
                                       std::set<unsigned long>& raclInd) const
 {
-    const std::set<unsigned long>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    if (!rclSet.empty()) {
-        raclInd.insert(rclSet.begin(), rclSet.end());
-        return rclSet.size();
+    const auto& range = _aulCells[CellIndex(ulX, ulY, ulZ)];
+    if (range.second > range.first) {
+        raclInd.insert(_aulPoints.begin() + range.first, _aulPoints.begin() + range.second);
+        return range.second - range.first;
     }
 
     return 0;
 }
 
-void PointsGrid::AddPoint(const Base::Vector3d& rclPt, unsigned long ulPtIndex, float /*fEpsilon*/)
+void PointsGrid::AppendElements(unsigned long ulX,
+                                unsigned long ulY,
+                                unsigned long ulZ,
+                                std::vector<unsigned long>& raulElements) const
 {
-    unsigned long ulX {}, ulY {}, ulZ {};
-    Pos(Base::Vector3d(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
-    if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
-        _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
-    }
+    const auto& range = _aulCells[CellIndex(ulX, ulY, ulZ)];
+    raulElements.insert(raulElements.end(),
+                        _aulPoints.begin() + range.first,
+                        _aulPoints.begin() + range.second);
 }
 
 void PointsGrid::Validate(const PointKernel& rclPoints)
@@ -751,11 +790,57 @@ void PointsGrid::RebuildGrid()
 
     InitGrid();
 
-    // Fill data structure
+    // Fill data structure with a counting sort: first determine the grid of each point, then
+    // assign each grid its range and finally copy the points in ascending order into their ranges
+    unsigned long ulCtCells = _aulCells.size();
+    std::vector<unsigned long> aulCellOfPoint(_ulCtElements, ulCtCells);
+    std::vector<unsigned long> aulCount(ulCtCells, 0);
 
     unsigned long i = 0;
     for (const auto& pnt : *_pclPoints) {
-        AddPoint(pnt, i++);
+        // invalid points of structured clouds are left out
+        if (std::isnan(pnt.x) || std::isnan(pnt.y) || std::isnan(pnt.z)) {
+            i++;
+            continue;
+        }
+        unsigned long ulX {}, ulY {}, ulZ {};
+        Pos(pnt, ulX, ulY, ulZ);
+        if (CheckPos(ulX, ulY, ulZ)) {
+            unsigned long ulCell = CellIndex(ulX, ulY, ulZ);
+            aulCellOfPoint[i] = ulCell;
+            aulCount[ulCell]++;
+        }
+        i++;
+    }
+
+    std::vector<std::pair<std::uint64_t, unsigned long>> aulOrder;
+    aulOrder.reserve(ulCtCells);
+    for (unsigned long ulX = 0; ulX < _ulCtGridsX; ulX++) {
+        for (unsigned long ulY = 0; ulY < _ulCtGridsY; ulY++) {
+            for (unsigned long ulZ = 0; ulZ < _ulCtGridsZ; ulZ++) {
+                aulOrder.emplace_back(mortonCode(ulX, ulY, ulZ), CellIndex(ulX, ulY, ulZ));
+            }
+        }
+    }
+    std::sort(aulOrder.begin(), aulOrder.end());
+
+    unsigned long ulOffset = 0;
+    for (const auto& it : aulOrder) {
+        _aulCells[it.second] = std::make_pair(ulOffset, ulOffset);
+        ulOffset += aulCount[it.second];
+    }
+
+    _aulPoints.resize(ulOffset);
+    _aclPoints.resize(ulOffset);
+    i = 0;
+    for (const auto& pnt : *_pclPoints) {
+        unsigned long ulCell = aulCellOfPoint[i];
+        if (ulCell < ulCtCells) {
+            unsigned long ulPos = _aulCells[ulCell].second++;
+            _aulPoints[ulPos] = i;
+            _aclPoints[ulPos] = pnt;
+        }
+        i++;
     }
 }
 
@@ -783,6 +868,191 @@ unsigned long PointsGrid::FindElements(const Base::Vector3d& rclPoint,
     return 0;
 }
 
+void PointsGrid::GetHullCells(unsigned long ulX,
+                              unsigned long ulY,
+                              unsigned long ulZ,
+                              unsigned long ulDistance,
+                              std::vector<unsigned long>& raulCells) const
+{
+    long nX1 = long(ulX) - long(ulDistance);
+    long nY1 = long(ulY) - long(ulDistance);
+    long nZ1 = long(ulZ) - long(ulDistance);
+    long nX2 = long(ulX) + long(ulDistance);
+    long nY2 = long(ulY) + long(ulDistance);
+    long nZ2 = long(ulZ) + long(ulDistance);
+
+    raulCells.clear();
+    for (long i = std::max<long>(nX1, 0); i <= std::min<long>(nX2, long(_ulCtGridsX) - 1); i++) {
+        for (long j = std::max<long>(nY1, 0); j <= std::min<long>(nY2, long(_ulCtGridsY) - 1);
+             j++) {
+            if (i == nX1 || i == nX2 || j == nY1 || j == nY2) {
+                // the whole column lies on the hull
+                for (long k = std::max<long>(nZ1, 0);
+                     k <= std::min<long>(nZ2, long(_ulCtGridsZ) - 1);
+                     k++) {
+                    raulCells.push_back(CellIndex(i, j, k));
+                }
+            }
+            else {
+                // only the top and bottom grid of the column
+                if (nZ1 >= 0) {
+                    raulCells.push_back(CellIndex(i, j, nZ1));
+                }
+                if (nZ2 < long(_ulCtGridsZ)) {
+                    raulCells.push_back(CellIndex(i, j, nZ2));
+                }
+            }
+        }
+    }
+}
+
+double PointsGrid::HullDistance(const Base::Vector3d& rclPt,
+                                unsigned long ulX,
+                                unsigned long ulY,
+                                unsigned long ulZ,
+                                unsigned long ulDistance) const
+{
+    // All elements lie inside the grid structure, so a side of the searched block that reaches
+    // the border of the structure doesn't limit the distance
+    double fDist = DOUBLE_MAX;
+    auto checkAxis = [&fDist, ulDistance](double fCoord,
+                                          unsigned long ulPos,
+                                          unsigned long ulCtGrids,
+                                          double fMin,
+                                          double fLen) {
+        if (ulPos >= ulDistance + 1) {
+            double fLower = fMin + double(ulPos - ulDistance) * fLen;
+            fDist = std::min<double>(fDist, fCoord - fLower);
+        }
+        if (ulPos + ulDistance + 1 < ulCtGrids) {
+            double fUpper = fMin + double(ulPos + ulDistance + 1) * fLen;
+            fDist = std::min<double>(fDist, fUpper - fCoord);
+        }
+    };
+
+    checkAxis(rclPt.x, ulX, _ulCtGridsX, _fMinX, _fGridLenX);
+    checkAxis(rclPt.y, ulY, _ulCtGridsY, _fMinY, _fGridLenY);
+    checkAxis(rclPt.z, ulZ, _ulCtGridsZ, _fMinZ, _fGridLenZ);
+    return std::max<double>(fDist, 0.0);
+}
+
+void PointsGrid::NearestElements(const Base::Vector3d& rclPt,
+                                 unsigned long ulK,
+                                 std::vector<unsigned long>& raulCells,
+                                 std::vector<std::pair<double, unsigned long>>& raclHeap) const
+{
+    raclHeap.clear();
+
+    unsigned long ulX {}, ulY {}, ulZ {};
+    Position(rclPt, ulX, ulY, ulZ);
+
+    // Visit the grids shell by shell until the nearest element outside is farther away than the
+    // k-th nearest element found so far
+    unsigned long ulMaxLevel = std::max<unsigned long>({_ulCtGridsX, _ulCtGridsY, _ulCtGridsZ});
+    for (unsigned long ulLevel = 0; ulLevel < ulMaxLevel; ulLevel++) {
+        GetHullCells(ulX, ulY, ulZ, ulLevel, raulCells);
+        for (unsigned long ulCell : raulCells) {
+            const auto& range = _aulCells[ulCell];
+            for (unsigned long ulPos = range.first; ulPos < range.second; ulPos++) {
+                auto candidate = std::make_pair(Base::DistanceP2(_aclPoints[ulPos], rclPt),
+                                                _aulPoints[ulPos]);
+                if (raclHeap.size() < ulK) {
+                    raclHeap.push_back(candidate);
+                    std::push_heap(raclHeap.begin(), raclHeap.end());
+                }
+                else if (candidate < raclHeap.front()) {
+                    std::pop_heap(raclHeap.begin(), raclHeap.end());
+                    raclHeap.back() = candidate;
+                    std::push_heap(raclHeap.begin(), raclHeap.end());
+                }
+            }
+        }
+
+        if (raclHeap.size() == ulK) {
+            double fDist = HullDistance(rclPt, ulX, ulY, ulZ, ulLevel);
+            if (fDist * fDist >= raclHeap.front().first) {
+                break;
+            }
+        }
+    }
+
+    std::sort_heap(raclHeap.begin(), raclHeap.end());
+}
+
+void PointsGrid::SearchNearest(const std::vector<Base::Vector3d>& rclPts,
+                               unsigned long ulK,
+                               std::vector<unsigned long>& raulNeighbours) const
+{
+    raulNeighbours.assign(rclPts.size() * ulK, ULONG_MAX);
+    if (ulK == 0 || _aulPoints.empty()) {
+        return;
+    }
+
+    forEachBlock(rclPts.size(), [&](std::size_t first, std::size_t last) {
+        std::vector<unsigned long> aulCells;
+        std::vector<std::pair<double, unsigned long>> aclHeap;
+        aclHeap.reserve(ulK);
+        for (std::size_t i = first; i < last; i++) {
+            NearestElements(rclPts[i], ulK, aulCells, aclHeap);
+            auto out = raulNeighbours.begin() + i * ulK;
+            for (const auto& it : aclHeap) {
+                *out++ = it.second;
+            }
+        }
+    });
+}
+
+void PointsGrid::SearchRadius(const std::vector<Base::Vector3d>& rclPts,
+                              double fRadius,
+                              std::vector<unsigned long>& raulOffsets,
+                              std::vector<unsigned long>& raulNeighbours) const
+{
+    raulOffsets.assign(rclPts.size() + 1, 0);
+    raulNeighbours.clear();
+    if (_aulPoints.empty() || fRadius < 0.0) {
+        return;
+    }
+
+    // Each block collects its elements separately, they are merged afterwards
+    std::vector<std::vector<unsigned long>> aulBlocks((rclPts.size() + BlockSize - 1) / BlockSize);
+    double fRadiusP2 = fRadius * fRadius;
+    forEachBlock(rclPts.size(), [&](std::size_t first, std::size_t last) {
+        std::vector<unsigned long>& aulElements = aulBlocks[first / BlockSize];
+        for (std::size_t i = first; i < last; i++) {
+            const Base::Vector3d& rclPt = rclPts[i];
+            unsigned long ulMinX {}, ulMinY {}, ulMinZ {};
+            unsigned long ulMaxX {}, ulMaxY {}, ulMaxZ {};
+            Position(rclPt - Base::Vector3d(fRadius, fRadius, fRadius), ulMinX, ulMinY, ulMinZ);
+            Position(rclPt + Base::Vector3d(fRadius, fRadius, fRadius), ulMaxX, ulMaxY, ulMaxZ);
+
+            std::size_t start = aulElements.size();
+            for (auto j = ulMinX; j <= ulMaxX; j++) {
+                for (auto k = ulMinY; k <= ulMaxY; k++) {
+                    for (auto l = ulMinZ; l <= ulMaxZ; l++) {
+                        const auto& range = _aulCells[CellIndex(j, k, l)];
+                        for (unsigned long ulPos = range.first; ulPos < range.second; ulPos++) {
+                            if (Base::DistanceP2(_aclPoints[ulPos], rclPt) <= fRadiusP2) {
+                                aulElements.push_back(_aulPoints[ulPos]);
+                            }
+                        }
+                    }
+                }
+            }
+
+            std::sort(aulElements.begin() + start, aulElements.end());
+            raulOffsets[i + 1] = aulElements.size() - start;
+        }
+    });
+
+    for (std::size_t i = 0; i < rclPts.size(); i++) {
+        raulOffsets[i + 1] += raulOffsets[i];
+    }
+    raulNeighbours.reserve(raulOffsets.back());
+    for (const auto& it : aulBlocks) {
+        raulNeighbours.insert(raulNeighbours.end(), it.begin(), it.end());
+    }
+}
+
 // ----------------------------------------------------------------
 
 PointsGridIterator::PointsGridIterator(const PointsGrid& rclG)
@@ -819,9 +1089,7 @@ bool PointsGridIterator::InitOnRay(const Base::Vector3d& rclPt,
     // point lies within global BB
     if (_rclGrid.GetBoundBox().IsInBox(rclPt)) {  // determine the voxel by the starting point
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        _rclGrid.AppendElements(_ulX, _ulY, _ulZ, raulElements);
         _bValidRay = true;
     }
     else {  // StartPoint outside
@@ -837,9 +1105,7 @@ bool PointsGridIterator::InitOnRay(const Base::Vector3d& rclPt,
                 _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
             }
 
-            raulElements.insert(raulElements.end(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+            _rclGrid.AppendElements(_ulX, _ulY, _ulZ, raulElements);
             _bValidRay = true;
         }
     }
@@ -903,9 +1169,7 @@ bool PointsGridIterator::NextOnRay(std::vector<unsigned long>& raulElements)
     if (_bValidRay && _rclGrid.CheckPos(_ulX, _ulY, _ulZ)) {
         GridElement pos(_ulX, _ulY, _ulZ);
         _cSearchPositions.insert(pos);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        _rclGrid.AppendElements(_ulX, _ulY, _ulZ, raulElements);
     }
     else {
         _bValidRay = false;  // ray exited
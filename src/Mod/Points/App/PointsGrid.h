@@ -24,6 +24,8 @@
 #define POINTS_GRID_H
 
 #include <set>
+#include <utility>
+#include <vector>
 
 #include <Base/BoundBox.h>
 #include <Base/Vector3D.h>
@@ -102,6 +104,21 @@ public:
     /** Searches for the nearest grids that contain elements from a point, the result are grid
      * indices. */
     void SearchNearestFromPoint(const Base::Vector3d& rclPt, std::set<unsigned long>& rclInd) const;
+    /** Searches for each point of \a rclPts the \a ulK nearest elements. The result is written to
+     * \a raulNeighbours with \a ulK consecutive entries per point, sorted by distance. If there
+     * are less than \a ulK elements the remaining entries are set to ULONG_MAX. The points are
+     * processed in parallel. */
+    void SearchNearest(const std::vector<Base::Vector3d>& rclPts,
+                       unsigned long ulK,
+                       std::vector<unsigned long>& raulNeighbours) const;
+    /** Searches for each point of \a rclPts the elements within the distance \a fRadius. The
+     * elements of the i-th point are written to \a raulNeighbours in the range from
+     * raulOffsets[i] to raulOffsets[i+1], sorted by index. The points are processed in
+     * parallel. */
+    void SearchRadius(const std::vector<Base::Vector3d>& rclPts,
+                      double fRadius,
+                      std::vector<unsigned long>& raulOffsets,
+                      std::vector<unsigned long>& raulNeighbours) const;
     //@}
 
     /** Returns the lengths of the grid elements in x,y and z direction. */
@@ -130,7 +147,8 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
-        return _aulGrid[ulX][ulY][ulZ].size();
+        const auto& range = _aulCells[CellIndex(ulX, ulY, ulZ)];
+        return range.second - range.first;
     }
     /** Finds all points that lie in the same grid as the point \a rclPoint. */
     unsigned long FindElements(const Base::Vector3d& rclPoint,
@@ -178,10 +196,44 @@ protected:
                  unsigned long ulZ,
                  unsigned long ulDistance,
                  std::set<unsigned long>& raclInd) const;
+    /** Get the cell indices of all grids around a given grid with distance \a ulDistance. Unlike
+     * GetHull() grids outside the structure are not replaced by the nearest ones. */
+    void GetHullCells(unsigned long ulX,
+                      unsigned long ulY,
+                      unsigned long ulZ,
+                      unsigned long ulDistance,
+                      std::vector<unsigned long>& raulCells) const;
+    /** Returns the distance from \a rclPt to the nearest element that lies outside the grids
+     * around a given grid with distance \a ulDistance. */
+    double HullDistance(const Base::Vector3d& rclPt,
+                        unsigned long ulX,
+                        unsigned long ulY,
+                        unsigned long ulZ,
+                        unsigned long ulDistance) const;
+    /** Appends the indices of the elements in the given grid. */
+    void AppendElements(unsigned long ulX,
+                        unsigned long ulY,
+                        unsigned long ulZ,
+                        std::vector<unsigned long>& raulElements) const;
+    /** Returns the position of the given grid in the cell ranges. */
+    unsigned long CellIndex(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+    {
+        return (ulX * _ulCtGridsY + ulY) * _ulCtGridsZ + ulZ;
+    }
 
 private:
-    std::vector<std::vector<std::vector<std::set<unsigned long>>>>
-        _aulGrid;                  /**< Grid data structure. */
+    /** Searches for the \a ulK nearest elements of a point. The result is sorted by distance. */
+    void NearestElements(const Base::Vector3d& rclPt,
+                         unsigned long ulK,
+                         std::vector<unsigned long>& raulCells,
+                         std::vector<std::pair<double, unsigned long>>& raclHeap) const;
+
+    /** Point indices sorted by grid element, the grid elements follow a Morton curve so that
+     * neighbouring grids are close in memory. */
+    std::vector<unsigned long> _aulPoints;
+    std::vector<Base::Vector3d> _aclPoints; /**< Point coordinates in the order of _aulPoints. */
+    std::vector<std::pair<unsigned long, unsigned long>>
+        _aulCells;                 /**< Range of each grid element in _aulPoints. */
     const PointKernel* _pclPoints; /**< The point kernel. */
     unsigned long _ulCtElements;   /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;     /**< Number of grid elements in z. */
@@ -198,11 +250,7 @@ private:
     friend class PointsGridIterator;
     friend class PointsGridIteratorStatistic;
 
-public:
 protected:
-    /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a
-     * ulPtIndex the corresponding index in the point kernel. */
-    void AddPoint(const Base::Vector3d& rclPt, unsigned long ulPtIndex, float fEpsilon = 0.0f);
     /** Returns the grid numbers to the given point \a rclPoint. */
     void Pos(const Base::Vector3d& rclPoint,
              unsigned long& rulX,
@@ -227,9 +275,7 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<unsigned long>& raulElements) const
     {
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        _rclGrid.AppendElements(_ulX, _ulY, _ulZ, raulElements);
     }
     /** @name Iteration */
     //@{
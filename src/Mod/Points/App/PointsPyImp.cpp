@@ -25,6 +25,7 @@
 #include <boost/math/special_functions/fpclassify.hpp>
 #endif
 
+#include <Base/ArrayViewPy.h>
 #include <Base/Builder3D.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
@@ -100,6 +101,8 @@ PyObject* PointsPy::copy(PyObject* args)
 
 PyObject* PointsPy::read(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getPointKernelPtr());
+
     const char* Name {};
     if (!PyArg_ParseTuple(args, "s", &Name)) {
         return nullptr;
@@ -154,6 +157,8 @@ PyObject* PointsPy::writeInventor(PyObject* args)
 
 PyObject* PointsPy::addPoints(PyObject* args)
 {
+    Base::ArrayViewPy::checkNotExported(getPointKernelPtr());
+
     PyObject* obj {};
     if (!PyArg_ParseTuple(args, "O", &obj)) {
         return nullptr;
@@ -242,6 +247,33 @@ PyObject* PointsPy::fromValid(PyObject* args)
     }
 }
 
+PyObject* PointsPy::getPointsBuffer(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    using float_type = PointKernel::float_type;
+    static_assert(sizeof(PointKernel::value_type) == 3 * sizeof(float_type),
+                  "Points are not stored as contiguous triples");
+
+    PY_TRY
+    {
+        std::vector<PointKernel::value_type>& points = getPointKernelPtr()->getBasicPoints();
+        Base::ArrayViewPy::Layout layout;
+        layout.data = points.empty() ? nullptr : &points.front().x;
+        layout.format = sizeof(float_type) == sizeof(float) ? "f" : "d";
+        layout.itemSize = sizeof(float_type);
+        layout.rows = static_cast<Py_ssize_t>(points.size());
+        layout.columns = 3;
+        layout.rowStride = sizeof(PointKernel::value_type);
+        layout.readOnly = isConst();
+        layout.source = getPointKernelPtr();
+        return Base::ArrayViewPy::create(layout, this);
+    }
+    PY_CATCH;
+}
+
 Py::Long PointsPy::getCountPoints() const
 {
     return Py::Long((long)getPointKernelPtr()->size());
@@ -0,0 +1,78 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# ***************************************************************************
+# *                                                                         *
+# *   Copyright (c) 2024 The FreeCAD Project Association                    *
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# ***************************************************************************
+
+import unittest
+
+import FreeCAD
+import Points
+
+
+class PointsBuffer(unittest.TestCase):
+    def setUp(self):
+        self.coords = [[0.0, 0.0, 0.0], [1.0, 2.0, 3.0], [-1.0, 0.5, 4.0]]
+        self.points = Points.Points([FreeCAD.Vector(*c) for c in self.coords])
+
+    def testPointsBuffer(self):
+        buf = self.points.getPointsBuffer()
+        self.assertEqual(buf.shape, (3, 3))
+        self.assertEqual(buf.format, "f")
+        self.assertEqual(buf.strides, (12, 4))
+        self.assertTrue(buf.c_contiguous)
+        self.assertFalse(buf.readonly)
+        self.assertEqual(buf.tolist(), self.coords)
+
+    def testWritable(self):
+        buf = self.points.getPointsBuffer()
+        buf[1, 0] = 5.0
+        self.assertEqual(self.points.Points[1].x, 5.0)
+
+    def testLifetime(self):
+        buf = Points.Points([FreeCAD.Vector(*c) for c in self.coords]).getPointsBuffer()
+        self.assertEqual(buf.tolist(), self.coords)
+
+    def testModifyWhileExported(self):
+        buf = self.points.getPointsBuffer()
+        with self.assertRaises(BufferError):
+            self.points.addPoints([FreeCAD.Vector(1.0, 1.0, 1.0)])
+        self.assertEqual(self.points.CountPoints, 3)
+
+        buf.release()
+        self.points.addPoints([FreeCAD.Vector(1.0, 1.0, 1.0)])
+        self.assertEqual(self.points.CountPoints, 4)
+
+    def testPropertyWhileExported(self):
+        doc = FreeCAD.newDocument("PointsBuffer")
+        try:
+            feature = doc.addObject("Points::Feature", "Points")
+            feature.Points = self.points
+            buf = feature.Points.getPointsBuffer()
+            self.assertTrue(buf.readonly)
+            with self.assertRaises(TypeError):
+                buf[0, 0] = 1.0
+
+            # the property continues with new points and the buffer keeps the old ones
+            feature.Points = Points.Points([FreeCAD.Vector(1.0, 1.0, 1.0)])
+            self.assertEqual(feature.Points.CountPoints, 1)
+            self.assertEqual(buf.tolist(), self.coords)
+        finally:
+            FreeCAD.closeDocument(doc.Name)
@@ -35,6 +35,8 @@
 #ifdef _PreComp_
 
 // standard
+#include <climits>
+#include <cstdint>
 #include <cstdio>
 
 // STL
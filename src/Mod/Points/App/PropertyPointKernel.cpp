@@ -28,6 +28,7 @@
 #include <iostream>
 #endif
 
+#include <Base/ArrayViewPy.h>
 #include <Base/Matrix.h>
 #include <Base/Writer.h>
 
@@ -43,9 +44,20 @@ PropertyPointKernel::PropertyPointKernel()
     : _cPoints(new PointKernel())
 {}
 
+void PropertyPointKernel::detachExported(bool copy)
+{
+    // The points that are exported to Python buffers must stay valid.
+    // So, they are left to the buffers and the property continues with new ones.
+    if (Base::ArrayViewPy::isExported(&*_cPoints)) {
+        Base::Reference<PointKernel> tmp(_cPoints);
+        _cPoints = copy ? new PointKernel(*tmp) : new PointKernel();
+    }
+}
+
 void PropertyPointKernel::setValue(const PointKernel& m)
 {
     aboutToSetValue();
+    detachExported(false);
     *_cPoints = m;
     hasSetValue();
 }
@@ -129,6 +141,7 @@ void PropertyPointKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachExported(true);
     _cPoints->RestoreDocFile(reader);
     hasSetValue();
 }
@@ -144,6 +157,7 @@ void PropertyPointKernel::Paste(const App::Property& from)
 {
     aboutToSetValue();
     const PropertyPointKernel& prop = dynamic_cast<const PropertyPointKernel&>(from);
+    detachExported(false);
     *(this->_cPoints) = *(prop._cPoints);
     hasSetValue();
 }
@@ -156,6 +170,7 @@ unsigned int PropertyPointKernel::getMemSize() const
 PointKernel* PropertyPointKernel::startEditing()
 {
     aboutToSetValue();
+    detachExported(true);
     return static_cast<PointKernel*>(_cPoints);
 }
 
@@ -199,6 +214,7 @@ void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndic
 void PropertyPointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachExported(true);
     _cPoints->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -87,6 +87,10 @@ public:
     void removeIndices(const std::vector<unsigned long>&);
     //@}
 
+private:
+    /// Replaces the points if they are exported to Python buffers
+    void detachExported(bool copy);
+
 private:
     Base::Reference<PointKernel> _cPoints;
 };
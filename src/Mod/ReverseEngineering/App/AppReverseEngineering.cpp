@@ -124,11 +124,14 @@ public:
         add_keyword_method("filterVoxelGrid",&Module::filterVoxelGrid,
             "filterVoxelGrid(dim)."
         );
+#endif
         add_keyword_method("normalEstimation",&Module::normalEstimation,
-            "normalEstimation(Points,[KSearch=0, SearchRadius=0]) -> Normals\n"
+            "normalEstimation(Points,[KSearch=0, SearchRadius=0, Orient=False]) -> Normals\n"
             "KSearch is an int and used to search the k-nearest neighbours in\n"
             "the k-d tree. Alternatively, SearchRadius (a float) can be used\n"
             "as spatial distance to determine the neighbours of a point\n"
+            "If Orient is True the normals are oriented consistently over the\n"
+            "whole point cloud\n"
             "Example:\n"
             "\n"
             "import ReverseEngineering as Reen\n"
@@ -142,20 +145,17 @@ public:
             "f.ViewObject.Proxy=0\n"
             "f.ViewObject.DisplayMode=1\n"
         );
-#endif
 #if defined(HAVE_PCL_SEGMENTATION)
         add_keyword_method("regionGrowingSegmentation",&Module::regionGrowingSegmentation,
             "regionGrowingSegmentation()."
         );
+#endif
         add_keyword_method("featureSegmentation",&Module::featureSegmentation,
             "featureSegmentation()."
         );
-#endif
-#if defined(HAVE_PCL_SAMPLE_CONSENSUS)
         add_keyword_method("sampleConsensus",&Module::sampleConsensus,
             "sampleConsensus()."
         );
-#endif
         initialize("This module is the ReverseEngineering module."); // register with Python
     }
 
@@ -793,17 +793,17 @@ Mesh.show(m)
         return Py::asObject(new Points::PointsPy(points_sample));
     }
 #endif
-#if defined(HAVE_PCL_FILTERS)
     Py::Object normalEstimation(const Py::Tuple& args, const Py::Dict& kwds)
     {
         PyObject *pts;
         int ksearch=0;
         double searchRadius=0;
+        PyObject *orient = Py_False;
 
-        static const std::array<const char*,4> kwds_normals {"Points", "KSearch", "SearchRadius", NULL};
-        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|id", kwds_normals,
+        static const std::array<const char*,5> kwds_normals {"Points", "KSearch", "SearchRadius", "Orient", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|idO!", kwds_normals,
                                         &(Points::PointsPy::Type), &pts,
-                                        &ksearch, &searchRadius))
+                                        &ksearch, &searchRadius, &PyBool_Type, &orient))
             throw Py::Exception();
 
         Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
@@ -812,6 +812,7 @@ Mesh.show(m)
         NormalEstimation estimate(*points);
         estimate.setKSearch(ksearch);
         estimate.setSearchRadius(searchRadius);
+        estimate.setOrientNormals(Base::asBoolean(orient));
         estimate.perform(normals);
 
         Py::List list;
@@ -821,7 +822,6 @@ Mesh.show(m)
 
         return list;
     }
-#endif
 #if defined(HAVE_PCL_SEGMENTATION)
     Py::Object regionGrowingSegmentation(const Py::Tuple& args, const Py::Dict& kwds)
     {
@@ -864,6 +864,7 @@ Mesh.show(m)
 
         return lists;
     }
+#endif
     Py::Object featureSegmentation(const Py::Tuple& args, const Py::Dict& kwds)
     {
         PyObject *pts;
@@ -891,8 +892,6 @@ Mesh.show(m)
 
         return lists;
     }
-#endif
-#if defined(HAVE_PCL_SAMPLE_CONSENSUS)
 /*
 import ReverseEngineering as reen
 import Points
@@ -974,7 +973,6 @@ Points.show(np)
 
         return dict;
     }
-#endif
 };
 
 PyObject* initModule()
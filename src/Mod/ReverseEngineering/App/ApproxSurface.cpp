@@ -22,14 +22,12 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
-#include <QFuture>
-#include <QFutureWatcher>
+#include <algorithm>
 #include <QtConcurrentMap>
 
 #include <Geom_BSplineSurface.hxx>
 #include <Precision.hxx>
-#include <math_Gauss.hxx>
-#include <math_Householder.hxx>
+#include <math_Crout.hxx>
 #endif
 
 #include <Base/Sequencer.h>
@@ -40,7 +38,6 @@
 
 
 using namespace Reen;
-namespace sp = std::placeholders;
 
 // SplineBasisfunction
 
@@ -964,7 +961,15 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
     double fMaxDiff = 0.0, fMaxScalar = 1.0;
     double fWeight = _fSmoothInfluence;
 
-    Base::SequencerLauncher seq("Calc surface...", iIter * _pvcPoints->Length());
+    Base::SequencerLauncher seq("Calc surface...", iIter);
+
+    // The points are corrected independently of each other, so the work is
+    // distributed over several threads. Each point writes its deviations to
+    // its own slot which are merged afterwards.
+    std::vector<int> indices(_pvcPoints->Length());
+    std::generate(indices.begin(), indices.end(), Base::iotaGen<int>(_pvcPoints->Lower()));
+    std::vector<double> scalars(indices.size());
+    std::vector<double> diffs(indices.size());
 
     do {
         fMaxScalar = 1.0;
@@ -978,8 +983,10 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
                                                                              _usUOrder - 1,
                                                                              _usVOrder - 1);
 
-        for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
+        QtConcurrent::blockingMap(indices, [&](int ii) {
             double fDeltaU, fDeltaV, fU, fV;
+            double fScalar = 1.0;
+            double fDiff = 0.0;
             const gp_Pnt& pnt = (*_pvcPoints)(ii);
             gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
             gp_Pnt PntX;
@@ -996,9 +1003,7 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
             // Check, if X = P
             if (!(X.IsEqual(P, 0.001, 0.001))) {
                 ErrorVec.Normalize();
-                if (fabs(clNormal * ErrorVec) < fMaxScalar) {
-                    fMaxScalar = fabs(clNormal * ErrorVec);
-                }
+                fScalar = fabs(clNormal * ErrorVec);
             }
 
             fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
@@ -1016,13 +1021,21 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
             if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
                 uvValue.SetX(fU);
                 uvValue.SetY(fV);
-                fMaxDiff = std::max<double>(fabs(fDeltaU), fMaxDiff);
-                fMaxDiff = std::max<double>(fabs(fDeltaV), fMaxDiff);
+                fDiff = std::max<double>(fabs(fDeltaU), fabs(fDeltaV));
             }
 
-            seq.next();
+            std::size_t slot = ii - _pvcPoints->Lower();
+            scalars[slot] = fScalar;
+            diffs[slot] = fDiff;
+        });
+
+        if (!indices.empty()) {
+            fMaxScalar = std::min(fMaxScalar, *std::min_element(scalars.begin(), scalars.end()));
+            fMaxDiff = *std::max_element(diffs.begin(), diffs.end());
         }
 
+        seq.next();
+
         if (_bSmoothing) {
             fWeight *= 0.5f;
             SolveWithSmoothing(fWeight);
@@ -1035,77 +1048,96 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
     } while (i < iIter && fMaxDiff > Precision::Confusion() && fMaxScalar < 0.99);
 }
 
-bool BSplineParameterCorrection::SolveWithoutSmoothing()
+void BSplineParameterCorrection::BuildNormalEquations(math_Matrix& MTM,
+                                                      math_Vector& Mbx,
+                                                      math_Vector& Mby,
+                                                      math_Vector& Mbz)
 {
-    unsigned ulSize = _pvcPoints->Length();
-    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
-    math_Matrix Xx(0, ulDim - 1, 0, 0);
-    math_Matrix Xy(0, ulDim - 1, 0, 0);
-    math_Matrix Xz(0, ulDim - 1, 0, 0);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
-
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        unsigned ulIdx = 0;
-
-        // Pre-calculation of the values of the base functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
+    MTM.Init(0.0);
+    Mbx.Init(0.0);
+    Mby.Init(0.0);
+    Mbz.Init(0.0);
+
+    // A point only influences the (order u) x (order v) control points whose
+    // basis functions are non-zero at its parameter, hence the row of the
+    // coefficient matrix of the overdetermined LGS has only as many entries.
+    int iUOrder = static_cast<int>(_usUOrder);
+    int iVOrder = static_cast<int>(_usVOrder);
+    int iVCtrlpoints = static_cast<int>(_usVCtrlpoints);
+    TColStd_Array1OfReal basisU(0, iUOrder - 1);
+    TColStd_Array1OfReal basisV(0, iVOrder - 1);
+    std::vector<int> column(iUOrder * iVOrder);
+    std::vector<double> value(iUOrder * iVOrder);
+
+    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
+        const gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
+        double fU = std::clamp(uvValue.X(), 0.0, 1.0);
+        double fV = std::clamp(uvValue.Y(), 0.0, 1.0);
+
+        // Only the non-zero basis functions of the knot spans are evaluated
+        int iUFirst = _clUSpline.FindSpan(fU) - iUOrder + 1;
+        int iVFirst = _clVSpline.FindSpan(fV) - iVOrder + 1;
+        _clUSpline.AllBasisFunctions(fU, basisU);
+        _clVSpline.AllBasisFunctions(fV, basisV);
+
+        // The columns increase with the index, so only the upper triangle is set
+        std::size_t ulIdx = 0;
+        for (int j = 0; j < iUOrder; j++) {
+            for (int k = 0; k < iVOrder; k++) {
+                column[ulIdx] = (iUFirst + j) * iVCtrlpoints + iVFirst + k;
+                value[ulIdx] = basisU(j) * basisV(k);
+                ulIdx++;
+            }
         }
 
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
-                }
+        const gp_Pnt& pnt = (*_pvcPoints)(ii);
+        for (std::size_t m = 0; m < column.size(); m++) {
+            double valueM = value[m];
+            if (valueM == 0.0) {
+                continue;
             }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
-                }
+            for (std::size_t n = m; n < column.size(); n++) {
+                MTM(column[m], column[n]) += valueM * value[n];
             }
+            Mbx(column[m]) += valueM * pnt.X();
+            Mby(column[m]) += valueM * pnt.Y();
+            Mbz(column[m]) += valueM * pnt.Z();
         }
     }
 
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
+    for (int m = MTM.LowerRow(); m <= MTM.UpperRow(); m++) {
+        for (int n = m + 1; n <= MTM.UpperCol(); n++) {
+            MTM(n, m) = MTM(m, n);
+        }
     }
+}
 
-    // Solve the over-determined LGS with Householder-Transformation
-    math_Householder hhX(M, bx);
-    math_Householder hhY(M, by);
-    math_Householder hhZ(M, bz);
+bool BSplineParameterCorrection::SolveNormalEquations(const math_Matrix& A,
+                                                      const math_Vector& Mbx,
+                                                      const math_Vector& Mby,
+                                                      const math_Vector& Mbz)
+{
+    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
+    math_Vector Xx(0, ulDim - 1);
+    math_Vector Xy(0, ulDim - 1);
+    math_Vector Xz(0, ulDim - 1);
 
-    if (!(hhX.IsDone() && hhY.IsDone() && hhZ.IsDone())) {
+    // The system matrix is symmetric, so it is factorized once by the
+    // Crout (LDL^T) decomposition and used for all three coordinates
+    math_Crout crout(A);
+    if (!crout.IsDone()) {
         // LGS could not be solved
         return false;
     }
-    Xx = hhX.AllValues();
-    Xy = hhY.AllValues();
-    Xz = hhZ.AllValues();
+
+    crout.Solve(Mbx, Xx);
+    crout.Solve(Mby, Xy);
+    crout.Solve(Mbz, Xz);
 
     unsigned ulIdx = 0;
     for (unsigned j = 0; j < _usUCtrlpoints; j++) {
         for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx, 0), Xy(ulIdx, 0), Xz(ulIdx, 0));
+            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx), Xy(ulIdx), Xz(ulIdx));
             ulIdx++;
         }
     }
@@ -1113,157 +1145,28 @@ bool BSplineParameterCorrection::SolveWithoutSmoothing()
     return true;
 }
 
-namespace Reen
-{
-class ScalarProduct
+bool BSplineParameterCorrection::SolveWithoutSmoothing()
 {
-public:
-    explicit ScalarProduct(const math_Matrix& mat)
-        : mat(mat)
-    {}
-    std::vector<double> multiply(int col) const
-    {
-        math_Vector vec = mat.Col(col);
-        std::vector<double> out(mat.ColNumber());
-        for (int n = mat.LowerCol(); n <= mat.UpperCol(); n++) {
-            out[n] = vec * mat.Col(n);
-        }
-        return out;
-    }
+    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
+    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
+    math_Vector Mbx(0, ulDim - 1);
+    math_Vector Mby(0, ulDim - 1);
+    math_Vector Mbz(0, ulDim - 1);
 
-private:
-    const math_Matrix& mat;
-};
-}  // namespace Reen
+    BuildNormalEquations(MTM, Mbx, Mby, Mbz);
+    return SolveNormalEquations(MTM, Mbx, Mby, Mbz);
+}
 
 bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
 {
-    unsigned ulSize = _pvcPoints->Length();
     unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
-    math_Vector Xx(0, ulDim - 1);
-    math_Vector Xy(0, ulDim - 1);
-    math_Vector Xz(0, ulDim - 1);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
+    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
     math_Vector Mbx(0, ulDim - 1);
     math_Vector Mby(0, ulDim - 1);
     math_Vector Mbz(0, ulDim - 1);
 
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        int ulIdx = 0;
-
-        // Pre-calculation of the values of the basis functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
-        }
-
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
-                }
-            }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
-                }
-            }
-        }
-    }
-
-    // The product of its transform and itself results in the quadratic
-    // system matrix (slowly)
-#if 0
-    math_Matrix MTM = M.TMultiply(M);
-#elif 0
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    for (unsigned m = 0; m < ulDim; m++) {
-        math_Vector Mm = M.Col(m);
-        for (unsigned n = m; n < ulDim; n++) {
-            MTM(m, n) = MTM(n, m) = Mm * M.Col(n);
-        }
-    }
-#else  // multi-threaded
-    std::vector<int> columns(ulDim);
-    std::generate(columns.begin(), columns.end(), Base::iotaGen<int>(0));
-    ScalarProduct scalar(M);
-    // NOLINTBEGIN
-    QFuture<std::vector<double>> future =
-        QtConcurrent::mapped(columns, std::bind(&ScalarProduct::multiply, &scalar, sp::_1));
-    // NOLINTEND
-    QFutureWatcher<std::vector<double>> watcher;
-    watcher.setFuture(future);
-    watcher.waitForFinished();
-
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    int rowIndex = 0;
-    for (const auto& it : future) {
-        int colIndex = 0;
-        for (std::vector<double>::const_iterator jt = it.begin(); jt != it.end();
-             ++jt, colIndex++) {
-            MTM(rowIndex, colIndex) = *jt;
-        }
-        rowIndex++;
-    }
-#endif
-
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
-    }
-    for (unsigned i = 0; i < ulDim; i++) {
-        math_Vector Mi = M.Col(i);
-        Mbx(i) = Mi * bx;
-        Mby(i) = Mi * by;
-        Mbz(i) = Mi * bz;
-    }
-
-    // Solve the LGS with the LU decomposition
-    math_Gauss mgGaussX(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussY(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussZ(MTM + fWeight * _clSmoothMatrix);
-
-    mgGaussX.Solve(Mbx, Xx);
-    if (!mgGaussX.IsDone()) {
-        return false;
-    }
-
-    mgGaussY.Solve(Mby, Xy);
-    if (!mgGaussY.IsDone()) {
-        return false;
-    }
-
-    mgGaussZ.Solve(Mbz, Xz);
-    if (!mgGaussZ.IsDone()) {
-        return false;
-    }
-
-    unsigned ulIdx = 0;
-    for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx), Xy(ulIdx), Xz(ulIdx));
-            ulIdx++;
-        }
-    }
-
-    return true;
+    BuildNormalEquations(MTM, Mbx, Mby, Mbz);
+    return SolveNormalEquations(MTM + fWeight * _clSmoothMatrix, Mbx, Mby, Mbz);
 }
 
 void BSplineParameterCorrection::CalcSmoothingTerms(bool bRecalc,
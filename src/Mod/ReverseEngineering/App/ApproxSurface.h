@@ -404,16 +404,31 @@ protected:
     void DoParameterCorrection(int iIter) override;
 
     /**
-     * Solve an overdetermined LGS with the help of the Householder-Tansformation
+     * Solve an overdetermined LGS by its normal equations
      */
     bool SolveWithoutSmoothing() override;
 
     /**
-     * Solve a regular system of equations by LU decomposition. Depending on the weighting,
+     * Solve a regular system of equations by Crout decomposition. Depending on the weighting,
      * smoothing terms are included
      */
     bool SolveWithSmoothing(double fWeight) override;
 
+    /**
+     * Sets up the normal equations M^T*M and M^T*b of the overdetermined LGS
+     * without building its coefficient matrix M
+     */
+    void
+    BuildNormalEquations(math_Matrix& MTM, math_Vector& Mbx, math_Vector& Mby, math_Vector& Mbz);
+
+    /**
+     * Solves the symmetric system for the three coordinates of the control points
+     */
+    bool SolveNormalEquations(const math_Matrix& A,
+                              const math_Vector& Mbx,
+                              const math_Vector& Mby,
+                              const math_Vector& Mbz);
+
 public:
     /**
      * Setting the knot vector
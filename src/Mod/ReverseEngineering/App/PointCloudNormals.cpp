@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <QtConcurrentMap>
+#include <Eigen/Eigenvalues>
+#endif
+
+#include <Base/Converter.h>
+#include <Base/Exception.h>
+#include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsGrid.h>
+#include <Mod/Points/App/Properties.h>
+
+#include "PointCloudNormals.h"
+
+
+using namespace Reen;
+
+namespace
+{
+// Number of points whose neighbours are searched at once, this limits the size of the buffers
+const std::size_t ChunkSize = 65536;
+
+bool isValid(const Base::Vector3d& vec)
+{
+    return !std::isnan(vec.x) && !std::isnan(vec.y) && !std::isnan(vec.z);
+}
+
+std::vector<Base::Vector3d> copyPoints(const Points::PointKernel& kernel)
+{
+    std::vector<Base::Vector3d> points;
+    points.reserve(kernel.size());
+    for (const auto& pnt : kernel) {
+        points.push_back(pnt);
+    }
+    return points;
+}
+
+// The normal of the plane fitted through the neighbours, i.e. the eigenvector of the smallest
+// eigenvalue of their covariance matrix
+Base::Vector3d fitNormal(const std::vector<Base::Vector3d>& points,
+                         const unsigned long* first,
+                         const unsigned long* last)
+{
+    Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+    int count = 0;
+    for (const unsigned long* it = first; it != last; ++it) {
+        if (*it != ULONG_MAX) {
+            const Base::Vector3d& pnt = points[*it];
+            mean += Eigen::Vector3d(pnt.x, pnt.y, pnt.z);
+            count++;
+        }
+    }
+
+    if (count < 3) {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        return Base::Vector3d(nan, nan, nan);
+    }
+
+    mean /= double(count);
+    Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+    for (const unsigned long* it = first; it != last; ++it) {
+        if (*it != ULONG_MAX) {
+            const Base::Vector3d& pnt = points[*it];
+            Eigen::Vector3d diff = Eigen::Vector3d(pnt.x, pnt.y, pnt.z) - mean;
+            covariance += diff * diff.transpose();
+        }
+    }
+
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+    solver.computeDirect(covariance);
+    Eigen::Vector3d normal = solver.eigenvectors().col(0);
+    return Base::Vector3d(normal.x(), normal.y(), normal.z());
+}
+
+struct Edge
+{
+    double weight;
+    unsigned long from;
+    unsigned long to;
+    bool operator>(const Edge& edge) const
+    {
+        return weight > edge.weight;
+    }
+};
+}  // namespace
+
+PointCloudNormals::PointCloudNormals(const Points::PointKernel& pts)
+    : myPoints(pts)
+{}
+
+void PointCloudNormals::perform(std::vector<Base::Vector3d>& normals) const
+{
+    if (kSearch <= 0 && searchRadius <= 0.0) {
+        throw Base::ValueError("Either the number of neighbours or the search radius must be set");
+    }
+
+    std::vector<Base::Vector3d> points = copyPoints(myPoints);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    normals.assign(points.size(), Base::Vector3d(nan, nan, nan));
+
+    std::vector<unsigned long> valid;
+    valid.reserve(points.size());
+    for (unsigned long i = 0; i < points.size(); i++) {
+        if (isValid(points[i])) {
+            valid.push_back(i);
+        }
+    }
+
+    Points::PointsGrid grid(myPoints);
+    std::vector<Base::Vector3d> queries;
+    std::vector<unsigned long> offsets;
+    std::vector<unsigned long> neighbours;
+    std::vector<std::size_t> slots;
+    for (std::size_t first = 0; first < valid.size(); first += ChunkSize) {
+        std::size_t last = std::min(first + ChunkSize, valid.size());
+        queries.clear();
+        for (std::size_t i = first; i < last; i++) {
+            queries.push_back(points[valid[i]]);
+        }
+
+        if (kSearch > 0) {
+            grid.SearchNearest(queries, static_cast<unsigned long>(kSearch), neighbours);
+            offsets.resize(queries.size() + 1);
+            for (std::size_t i = 0; i < offsets.size(); i++) {
+                offsets[i] = i * kSearch;
+            }
+        }
+        else {
+            grid.SearchRadius(queries, searchRadius, offsets, neighbours);
+        }
+
+        slots.resize(queries.size());
+        std::iota(slots.begin(), slots.end(), 0);
+        QtConcurrent::blockingMap(slots, [&](const std::size_t& slot) {
+            unsigned long index = valid[first + slot];
+            Base::Vector3d normal = fitNormal(points,
+                                              neighbours.data() + offsets[slot],
+                                              neighbours.data() + offsets[slot + 1]);
+            // like PCL flip the normal towards the view point
+            if (isValid(normal) && (viewPoint - points[index]) * normal < 0.0) {
+                normal = -normal;
+            }
+            normals[index] = normal;
+        });
+    }
+}
+
+void PointCloudNormals::perform(Points::PropertyNormalList& normals) const
+{
+    std::vector<Base::Vector3d> values;
+    perform(values);
+
+    std::vector<Base::Vector3f> data;
+    data.reserve(values.size());
+    for (const auto& it : values) {
+        data.push_back(Base::convertTo<Base::Vector3f>(it));
+    }
+    normals.setValues(data);
+}
+
+void PointCloudNormals::orient(const Points::PointKernel& kernel,
+                               std::vector<Base::Vector3d>& normals,
+                               int ksearch)
+{
+    if (normals.size() != kernel.size()) {
+        throw Base::ValueError("The number of normals doesn't match the number of points");
+    }
+    if (ksearch <= 0) {
+        return;
+    }
+
+    std::vector<Base::Vector3d> points = copyPoints(kernel);
+    std::vector<unsigned long> valid;
+    std::vector<bool> visited(points.size(), true);
+    for (unsigned long i = 0; i < points.size(); i++) {
+        if (isValid(points[i]) && isValid(normals[i])) {
+            valid.push_back(i);
+            visited[i] = false;
+        }
+    }
+
+    // The graph of the k nearest neighbours
+    auto k = static_cast<unsigned long>(ksearch);
+    std::vector<unsigned long> graph(points.size() * k, ULONG_MAX);
+    Points::PointsGrid grid(kernel);
+    std::vector<Base::Vector3d> queries;
+    std::vector<unsigned long> neighbours;
+    for (std::size_t first = 0; first < valid.size(); first += ChunkSize) {
+        std::size_t last = std::min(first + ChunkSize, valid.size());
+        queries.clear();
+        for (std::size_t i = first; i < last; i++) {
+            queries.push_back(points[valid[i]]);
+        }
+
+        grid.SearchNearest(queries, k, neighbours);
+        for (std::size_t i = first; i < last; i++) {
+            std::copy_n(neighbours.begin() + (i - first) * k, k, graph.begin() + valid[i] * k);
+        }
+    }
+
+    // Propagate the orientation along the spanning tree that prefers parallel normals
+    std::priority_queue<Edge, std::vector<Edge>, std::greater<Edge>> queue;
+    auto visit = [&](unsigned long index) {
+        visited[index] = true;
+        for (unsigned long j = 0; j < k; j++) {
+            unsigned long next = graph[index * k + j];
+            if (next != ULONG_MAX && !visited[next]) {
+                queue.push(Edge {1.0 - std::fabs(normals[index] * normals[next]), index, next});
+            }
+        }
+    };
+
+    // Each connected part starts at its highest point whose normal is expected to point upwards
+    std::sort(valid.begin(), valid.end(), [&points](unsigned long a, unsigned long b) {
+        return points[a].z > points[b].z;
+    });
+    for (unsigned long seed : valid) {
+        if (visited[seed]) {
+            continue;
+        }
+        if (normals[seed].z < 0.0) {
+            normals[seed] = -normals[seed];
+        }
+
+        visit(seed);
+        while (!queue.empty()) {
+            Edge edge = queue.top();
+            queue.pop();
+            if (visited[edge.to]) {
+                continue;
+            }
+            if (normals[edge.from] * normals[edge.to] < 0.0) {
+                normals[edge.to] = -normals[edge.to];
+            }
+            visit(edge.to);
+        }
+    }
+}
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef REEN_POINTCLOUDNORMALS_H
+#define REEN_POINTCLOUDNORMALS_H
+
+#include <vector>
+
+#include <Base/Vector3D.h>
+#include <Mod/ReverseEngineering/ReverseEngineeringGlobal.h>
+
+
+namespace Points
+{
+class PointKernel;
+class PropertyNormalList;
+}  // namespace Points
+
+namespace Reen
+{
+
+/**
+ * Estimates the normals of a point cloud by a principal component analysis of the neighbours of
+ * each point. Unlike NormalEstimation it doesn't depend on PCL, the neighbours are searched with
+ * a Points::PointsGrid and the points are processed in parallel.
+ */
+class ReenExport PointCloudNormals
+{
+public:
+    explicit PointCloudNormals(const Points::PointKernel&);
+    /** \brief Set the number of k nearest neighbors to use for the normal estimation.
+     * \param[in] k the number of k-nearest neighbors
+     */
+    void setKSearch(int k)
+    {
+        kSearch = k;
+    }
+    /** \brief Set the sphere radius that is to be used for determining the nearest neighbors
+     * if no k is set.
+     * \param[in] radius the sphere radius used as the maximum distance to consider a point a
+     * neighbor
+     */
+    void setSearchRadius(double radius)
+    {
+        searchRadius = radius;
+    }
+    /** \brief Set the view point the normals are flipped towards.
+     */
+    void setViewPoint(const Base::Vector3d& point)
+    {
+        viewPoint = point;
+    }
+
+    /** \brief Perform the normal estimation. Invalid points or points with less than three
+     * neighbours get a NaN normal.
+     * \param[out] the estimated normals
+     */
+    void perform(std::vector<Base::Vector3d>& normals) const;
+    /** \brief Perform the normal estimation and set the result to the property.
+     */
+    void perform(Points::PropertyNormalList& normals) const;
+
+    /** \brief Orients the normals consistently. Starting at the highest point the orientation is
+     * propagated to the k nearest neighbours, preferring the neighbours with the most parallel
+     * normals (Hoppe et al.).
+     */
+    static void orient(const Points::PointKernel&, std::vector<Base::Vector3d>& normals, int ksearch);
+
+private:
+    const Points::PointKernel& myPoints;
+    int kSearch {0};
+    double searchRadius {0.0};
+    Base::Vector3d viewPoint;
+};
+
+}  // namespace Reen
+
+#endif  // REEN_POINTCLOUDNORMALS_H
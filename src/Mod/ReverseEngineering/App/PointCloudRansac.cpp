@@ -0,0 +1,318 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <QtConcurrentMap>
+#include <Eigen/Dense>
+#endif
+
+#include <Base/Exception.h>
+
+#include "PointCloudRansac.h"
+
+
+using namespace Reen;
+
+namespace
+{
+// Number of hypotheses that are verified at once. It doesn't depend on the number of threads so
+// that the result is reproducible.
+const int BatchSize = 64;
+
+struct Hypothesis
+{
+    std::vector<double> parameters;
+    int inliers {-1};
+};
+
+bool isValid(const Base::Vector3d& vec)
+{
+    return !std::isnan(vec.x) && !std::isnan(vec.y) && !std::isnan(vec.z);
+}
+
+// The angle between the lines of the two vectors in the range [0, pi/2]
+double lineAngle(const Base::Vector3d& vec1, const Base::Vector3d& vec2)
+{
+    double len = vec1.Length() * vec2.Length();
+    if (len <= 0.0) {
+        return 0.0;
+    }
+    return std::acos(std::min(std::fabs(vec1 * vec2) / len, 1.0));
+}
+}  // namespace
+
+PointCloudRansac::PointCloudRansac(Model model,
+                                   const std::vector<Base::Vector3d>& points,
+                                   const std::vector<Base::Vector3d>& normals)
+    : myModel(model)
+    , myPoints(points)
+    , myNormals(normals)
+{}
+
+int PointCloudRansac::sampleSize() const
+{
+    switch (myModel) {
+        case Plane:
+            return 3;
+        case Sphere:
+            return 4;
+        case Cylinder:
+            return 2;
+    }
+    return 0;
+}
+
+bool PointCloudRansac::computeModel(const std::vector<int>& sample,
+                                    std::vector<double>& parameters) const
+{
+    parameters.clear();
+    switch (myModel) {
+        case Plane: {
+            const Base::Vector3d& p0 = myPoints[sample[0]];
+            Base::Vector3d normal = (myPoints[sample[1]] - p0) % (myPoints[sample[2]] - p0);
+            double len = normal.Length();
+            if (len < 1e-12) {
+                return false;  // collinear points
+            }
+            normal /= len;
+            parameters = {normal.x, normal.y, normal.z, -(normal * p0)};
+            return true;
+        }
+        case Sphere: {
+            // the center has the same distance to all four points
+            const Base::Vector3d& p0 = myPoints[sample[0]];
+            Eigen::Matrix3d mat;
+            Eigen::Vector3d rhs;
+            for (int i = 0; i < 3; i++) {
+                const Base::Vector3d& pi = myPoints[sample[i + 1]];
+                mat.row(i) << 2.0 * (pi.x - p0.x), 2.0 * (pi.y - p0.y), 2.0 * (pi.z - p0.z);
+                rhs(i) = pi.Sqr() - p0.Sqr();
+            }
+            if (std::fabs(mat.determinant()) < 1e-12) {
+                return false;  // coplanar points
+            }
+            Eigen::Vector3d center = mat.colPivHouseholderQr().solve(rhs);
+            double radius = (p0 - Base::Vector3d(center.x(), center.y(), center.z())).Length();
+            if (radius < radiusMin || radius > radiusMax) {
+                return false;
+            }
+            parameters = {center.x(), center.y(), center.z(), radius};
+            return true;
+        }
+        case Cylinder: {
+            // the axis is the shortest connection of the two lines along the point normals,
+            // computed the same way as PCL does
+            const Base::Vector3d& p1 = myPoints[sample[0]];
+            const Base::Vector3d& p2 = myPoints[sample[1]];
+            const Base::Vector3d& n1 = myNormals[sample[0]];
+            const Base::Vector3d& n2 = myNormals[sample[1]];
+            if (!isValid(n1) || !isValid(n2) || Base::DistanceP2(p1, p2) < 1e-8) {
+                return false;
+            }
+
+            Base::Vector3d w = n1 + p1 - p2;
+            double a = n1 * n1;
+            double b = n1 * n2;
+            double c = n2 * n2;
+            double d = n1 * w;
+            double e = n2 * w;
+            double denominator = a * c - b * b;
+            double sc {}, tc {};
+            if (denominator < 1e-8) {
+                sc = 0.0;
+                tc = (b > c ? d / b : e / c);
+            }
+            else {
+                sc = (b * e - c * d) / denominator;
+                tc = (a * e - b * d) / denominator;
+            }
+
+            Base::Vector3d linePt = p1 + n1 + sc * n1;
+            Base::Vector3d lineDir = p2 + tc * n2 - linePt;
+            double len = lineDir.Length();
+            if (len < 1e-12) {
+                return false;
+            }
+            lineDir /= len;
+            double radius = p1.DistanceToLine(linePt, lineDir);
+            if (radius < radiusMin || radius > radiusMax) {
+                return false;
+            }
+            parameters = {linePt.x, linePt.y, linePt.z, lineDir.x, lineDir.y, lineDir.z, radius};
+            return true;
+        }
+    }
+    return false;
+}
+
+double PointCloudRansac::distance(int index, const std::vector<double>& parameters) const
+{
+    const Base::Vector3d& pnt = myPoints[index];
+    double dist = 0.0;
+    Base::Vector3d direction;  // the model normal at the point
+    switch (myModel) {
+        case Plane: {
+            direction.Set(parameters[0], parameters[1], parameters[2]);
+            dist = std::fabs(direction * pnt + parameters[3]);
+            break;
+        }
+        case Sphere: {
+            direction = pnt - Base::Vector3d(parameters[0], parameters[1], parameters[2]);
+            dist = std::fabs(direction.Length() - parameters[3]);
+            break;
+        }
+        case Cylinder: {
+            Base::Vector3d base(parameters[0], parameters[1], parameters[2]);
+            Base::Vector3d axis(parameters[3], parameters[4], parameters[5]);
+            Base::Vector3d vec = pnt - base;
+            direction = vec - ((vec * axis) * axis);
+            dist = std::fabs(direction.Length() - parameters[6]);
+            break;
+        }
+    }
+
+    if (normalDistanceWeight > 0.0 && !myNormals.empty()) {
+        double angle = lineAngle(myNormals[index], direction);
+        dist = std::fabs(normalDistanceWeight * angle + (1.0 - normalDistanceWeight) * dist);
+    }
+
+    return dist;
+}
+
+int PointCloudRansac::countInliers(const std::vector<int>& indices,
+                                   const std::vector<double>& parameters) const
+{
+    int count = 0;
+    for (int index : indices) {
+        if (distance(index, parameters) <= distanceThreshold) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool PointCloudRansac::perform(std::vector<double>& parameters, std::vector<int>& inliers) const
+{
+    parameters.clear();
+    inliers.clear();
+
+    bool needNormals = (myModel == Cylinder || normalDistanceWeight > 0.0);
+    if (needNormals && myNormals.size() != myPoints.size()) {
+        throw Base::ValueError("The model requires a normal for each point");
+    }
+
+    std::vector<int> indices;
+    if (myIndices.empty()) {
+        indices.resize(myPoints.size());
+        std::iota(indices.begin(), indices.end(), 0);
+    }
+    else {
+        // duplicates must go, or drawing distinct samples may never end
+        indices = myIndices;
+        std::sort(indices.begin(), indices.end());
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    }
+    indices.erase(std::remove_if(indices.begin(),
+                                 indices.end(),
+                                 [this](int index) {
+                                     return index < 0 || index >= int(myPoints.size())
+                                         || !isValid(myPoints[index]);
+                                 }),
+                  indices.end());
+
+    int numSamples = sampleSize();
+    if (int(indices.size()) < numSamples) {
+        return false;
+    }
+
+    std::mt19937 generator(5489U);
+    std::uniform_int_distribution<std::size_t> pick(0, indices.size() - 1);
+    std::vector<int> sample(numSamples);
+    std::vector<Hypothesis> batch(BatchSize);
+    std::vector<double> bestParameters;
+    int bestInliers = 0;
+
+    // The number of iterations is adapted to the inlier ratio of the best model so far
+    double requiredIterations = maxIterations;
+    int iterations = 0;
+    while (iterations < requiredIterations && iterations < maxIterations) {
+        // draw the samples sequentially and verify the hypotheses in parallel
+        int count = std::min(BatchSize, maxIterations - iterations);
+        for (int i = 0; i < count; i++) {
+            for (int j = 0; j < numSamples; j++) {
+                auto last = sample.begin() + j;
+                int candidate {};
+                do {
+                    candidate = indices[pick(generator)];
+                } while (std::find(sample.begin(), last, candidate) != last);
+                sample[j] = candidate;
+            }
+            batch[i].inliers = -1;
+            computeModel(sample, batch[i].parameters);
+        }
+
+        QtConcurrent::blockingMap(batch.begin(),
+                                  batch.begin() + count,
+                                  [this, &indices](Hypothesis& hypothesis) {
+                                      if (!hypothesis.parameters.empty()) {
+                                          hypothesis.inliers =
+                                              countInliers(indices, hypothesis.parameters);
+                                      }
+                                  });
+
+        for (int i = 0; i < count; i++) {
+            if (batch[i].inliers > bestInliers) {
+                bestInliers = batch[i].inliers;
+                bestParameters = batch[i].parameters;
+
+                double ratio = double(bestInliers) / double(indices.size());
+                double noOutliers = 1.0 - std::pow(ratio, numSamples);
+                noOutliers = std::clamp(noOutliers,
+                                        std::numeric_limits<double>::epsilon(),
+                                        1.0 - std::numeric_limits<double>::epsilon());
+                requiredIterations = std::log(1.0 - probability) / std::log(noOutliers);
+            }
+        }
+
+        iterations += count;
+    }
+
+    if (bestParameters.empty()) {
+        return false;
+    }
+
+    parameters = bestParameters;
+    for (int index : indices) {
+        if (distance(index, parameters) <= distanceThreshold) {
+            inliers.push_back(index);
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef REEN_POINTCLOUDRANSAC_H
+#define REEN_POINTCLOUDRANSAC_H
+
+#include <vector>
+
+#include <Base/Vector3D.h>
+#include <Mod/ReverseEngineering/ReverseEngineeringGlobal.h>
+
+
+namespace Reen
+{
+
+/**
+ * Fits a plane, sphere or cylinder to a point cloud with the random sample consensus method.
+ * Unlike SampleConsensus it doesn't depend on PCL, the model parameters are compatible with the
+ * PCL models though:
+ * - plane: a, b, c, d of the plane equation a*x + b*y + c*z + d = 0
+ * - sphere: center x, y, z and radius
+ * - cylinder: point x, y, z and direction x, y, z of the axis, and radius
+ *
+ * Several model hypotheses are verified in parallel.
+ */
+class ReenExport PointCloudRansac
+{
+public:
+    enum Model
+    {
+        Plane,
+        Sphere,
+        Cylinder,
+    };
+
+    /** The cylinder needs \a normals for all points, for the other models they are optional and
+     * only used if a normal distance weight is set.
+     */
+    PointCloudRansac(Model model,
+                     const std::vector<Base::Vector3d>& points,
+                     const std::vector<Base::Vector3d>& normals);
+
+    /** Restricts the search to the given points. */
+    void setIndices(const std::vector<int>& indices)
+    {
+        myIndices = indices;
+    }
+    /** Sets the maximum distance of an inlier to the model. */
+    void setDistanceThreshold(double threshold)
+    {
+        distanceThreshold = threshold;
+    }
+    /** Sets the weight of the angle between the point normal and the model normal in the
+     * distance of a point to the model, the weight of the euclidean distance is (1 - weight).
+     */
+    void setNormalDistanceWeight(double weight)
+    {
+        normalDistanceWeight = weight;
+    }
+    void setMaxIterations(int iterations)
+    {
+        maxIterations = iterations;
+    }
+    /** Sets the probability to pick at least one sample free of outliers. */
+    void setProbability(double value)
+    {
+        probability = value;
+    }
+    /** Limits the radius of spheres and cylinders. */
+    void setRadiusLimits(double minRadius, double maxRadius)
+    {
+        radiusMin = minRadius;
+        radiusMax = maxRadius;
+    }
+    double getProbability() const
+    {
+        return probability;
+    }
+
+    /** Searches for the model with the most inliers. Returns false if no model was found.
+     * \param[out] parameters the model coefficients
+     * \param[out] inliers the indices of the points lying on the model
+     */
+    bool perform(std::vector<double>& parameters, std::vector<int>& inliers) const;
+
+private:
+    int sampleSize() const;
+    bool computeModel(const std::vector<int>& sample, std::vector<double>& parameters) const;
+    double distance(int index, const std::vector<double>& parameters) const;
+    int countInliers(const std::vector<int>& indices, const std::vector<double>& parameters) const;
+
+private:
+    Model myModel;
+    const std::vector<Base::Vector3d>& myPoints;
+    const std::vector<Base::Vector3d>& myNormals;
+    std::vector<int> myIndices;
+    double distanceThreshold {0.01};
+    double normalDistanceWeight {0.0};
+    double probability {0.99};
+    double radiusMin {0.0};
+    double radiusMax {DOUBLE_MAX};
+    int maxIterations {10000};
+};
+
+}  // namespace Reen
+
+#endif  // REEN_POINTCLOUDRANSAC_H
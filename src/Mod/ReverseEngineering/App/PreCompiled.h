@@ -41,15 +41,28 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <map>
+#include <numeric>
+#include <queue>
+#include <random>
 
 // boost
 #include <boost/math/special_functions/fpclassify.hpp>
 
+// Eigen
+#include <Eigen/Dense>
+#include <Eigen/Eigenvalues>
+
 // OpenCasCade
 #include <Geom_BSplineSurface.hxx>
 #include <Precision.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <math_Crout.hxx>
 #include <math_Gauss.hxx>
 #include <math_Householder.hxx>
 
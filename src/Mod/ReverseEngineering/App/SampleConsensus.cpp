@@ -28,6 +28,8 @@
 #include <Base/Exception.h>
 #include <Mod/Points/App/Points.h>
 
+#include "PointCloudNormals.h"
+#include "PointCloudRansac.h"
 #include "SampleConsensus.h"
 
 
@@ -41,10 +43,12 @@
 #include <pcl/sample_consensus/sac_model_sphere.h>
 
 using namespace std;
-using namespace Reen;
 using pcl::PointCloud;
 using pcl::PointNormal;
 using pcl::PointXYZ;
+#endif
+
+using namespace Reen;
 
 SampleConsensus::SampleConsensus(SacModel sac,
                                  const Points::PointKernel& pts,
@@ -54,6 +58,7 @@ SampleConsensus::SampleConsensus(SacModel sac,
     , myNormals(nor)
 {}
 
+#if defined(HAVE_PCL_SAMPLE_CONSENSUS)
 double SampleConsensus::perform(std::vector<float>& parameters, std::vector<int>& model)
 {
     pcl::PointCloud<pcl::PointXYZ>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZ>);
@@ -140,4 +145,52 @@ double SampleConsensus::perform(std::vector<float>& parameters, std::vector<int>
     return ransac.getProbability();
 }
 
+#else
+
+double SampleConsensus::perform(std::vector<float>& parameters, std::vector<int>& model)
+{
+    PointCloudRansac::Model sacModel {};
+    switch (mySac) {
+        case SACMODEL_PLANE:
+            sacModel = PointCloudRansac::Plane;
+            break;
+        case SACMODEL_SPHERE:
+            sacModel = PointCloudRansac::Sphere;
+            break;
+        case SACMODEL_CYLINDER:
+            sacModel = PointCloudRansac::Cylinder;
+            break;
+        default:
+            throw Base::RuntimeError("Unsupported SAC model");
+    }
+
+    std::vector<Base::Vector3d> points;
+    points.reserve(myPoints.size());
+    for (const auto& pnt : myPoints) {
+        points.push_back(pnt);
+    }
+
+    std::vector<Base::Vector3d> normals;
+    if (sacModel == PointCloudRansac::Cylinder) {
+        if (myNormals.size() == points.size()) {
+            normals = myNormals;
+        }
+        else {
+            PointCloudNormals estimate(myPoints);
+            estimate.setKSearch(10);
+            estimate.perform(normals);
+        }
+    }
+
+    PointCloudRansac ransac(sacModel, points, normals);
+    ransac.setDistanceThreshold(.01);
+    std::vector<double> coefficients;
+    ransac.perform(coefficients, model);
+    for (double value : coefficients) {
+        parameters.push_back(float(value));
+    }
+
+    return ransac.getProbability();
+}
+
 #endif  // HAVE_PCL_SAMPLE_CONSENSUS
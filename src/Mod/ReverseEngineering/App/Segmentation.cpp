@@ -24,6 +24,8 @@
 
 #include <Mod/Points/App/Points.h>
 
+#include "PointCloudNormals.h"
+#include "PointCloudRansac.h"
 #include "Segmentation.h"
 
 
@@ -54,12 +56,12 @@ using pcl::PointNormal;
 using pcl::PointXYZ;
 #endif
 
-#if defined(HAVE_PCL_SEGMENTATION)
 Segmentation::Segmentation(const Points::PointKernel& pts, std::list<std::vector<int>>& clusters)
     : myPoints(pts)
     , myClusters(clusters)
 {}
 
+#if defined(HAVE_PCL_SEGMENTATION)
 void Segmentation::perform(int ksearch)
 {
     // All the objects needed
@@ -156,17 +158,69 @@ void Segmentation::perform(int ksearch)
     extract.filter(*cloud_cylinder);
 }
 
+#else
+
+void Segmentation::perform(int ksearch)
+{
+    std::vector<Base::Vector3d> points;
+    points.reserve(myPoints.size());
+    for (const auto& pnt : myPoints) {
+        points.push_back(pnt);
+    }
+
+    // Estimate point normals
+    std::vector<Base::Vector3d> normals;
+    PointCloudNormals estimate(myPoints);
+    estimate.setKSearch(ksearch);
+    estimate.perform(normals);
+
+    // Obtain the plane inliers
+    std::vector<double> coefficients;
+    std::vector<int> inliersPlane;
+    PointCloudRansac plane(PointCloudRansac::Plane, points, normals);
+    plane.setNormalDistanceWeight(0.1);
+    plane.setMaxIterations(100);
+    plane.setDistanceThreshold(0.03);
+    plane.perform(coefficients, inliersPlane);
+    myClusters.push_back(inliersPlane);
+
+    // Remove the planar inliers, search for a cylinder in the rest
+    std::vector<bool> isPlane(points.size(), false);
+    for (int index : inliersPlane) {
+        isPlane[index] = true;
+    }
+    std::vector<int> remaining;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (!isPlane[i]) {
+            remaining.push_back(int(i));
+        }
+    }
+
+    std::vector<int> inliersCylinder;
+    PointCloudRansac cylinder(PointCloudRansac::Cylinder, points, normals);
+    cylinder.setIndices(remaining);
+    cylinder.setNormalDistanceWeight(0.1);
+    cylinder.setMaxIterations(10000);
+    cylinder.setDistanceThreshold(0.05);
+    cylinder.setRadiusLimits(0, 0.1);
+    if (!remaining.empty()) {
+        cylinder.perform(coefficients, inliersCylinder);
+    }
+    myClusters.push_back(inliersCylinder);
+}
+
 #endif  // HAVE_PCL_SEGMENTATION
 
 // ----------------------------------------------------------------------------
 
-#if defined(HAVE_PCL_FILTERS)
 NormalEstimation::NormalEstimation(const Points::PointKernel& pts)
     : myPoints(pts)
     , kSearch(0)
     , searchRadius(0)
+    , orientNormals(false)
 {}
 
+#if defined(HAVE_PCL_FILTERS)
 void NormalEstimation::perform(std::vector<Base::Vector3d>& normals)
 {
     // Copy the points
@@ -210,6 +264,24 @@ void NormalEstimation::perform(std::vector<Base::Vector3d>& normals)
          ++it) {
         normals.push_back(Base::Vector3d(it->normal_x, it->normal_y, it->normal_z));
     }
+
+    if (orientNormals) {
+        PointCloudNormals::orient(myPoints, normals, kSearch > 0 ? kSearch : 10);
+    }
+}
+
+#else
+
+void NormalEstimation::perform(std::vector<Base::Vector3d>& normals)
+{
+    PointCloudNormals estimate(myPoints);
+    estimate.setKSearch(kSearch);
+    estimate.setSearchRadius(searchRadius);
+    estimate.perform(normals);
+
+    if (orientNormals) {
+        PointCloudNormals::orient(myPoints, normals, kSearch > 0 ? kSearch : 10);
+    }
 }
 
 #endif  // HAVE_PCL_FILTERS
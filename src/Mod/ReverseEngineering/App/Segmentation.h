@@ -72,6 +72,14 @@ public:
         searchRadius = radius;
     }
 
+    /** \brief Orient the normals consistently over the whole point cloud instead of flipping
+     * them towards the origin only.
+     */
+    inline void setOrientNormals(bool on)
+    {
+        orientNormals = on;
+    }
+
     /** \brief Perform the normal estimation.
      * \param[out] the estimated normals
      */
@@ -81,6 +89,7 @@ private:
     const Points::PointKernel& myPoints;
     int kSearch;
     double searchRadius;
+    bool orientNormals;
 };
 
 }  // namespace Reen
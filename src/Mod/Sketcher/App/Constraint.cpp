@@ -27,12 +27,16 @@
 #include <cmath>
 #endif
 
+#include <Base/Exception.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Tools.h>
 #include <Base/Writer.h>
 
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/thread.hpp>
+#include <Mod/Part/App/GeometryExtension.h>
+
 #include "Constraint.h"
 #include "ConstraintPy.h"
 
@@ -226,6 +230,44 @@ void Constraint::Restore(XMLReader& reader)
     }
 }
 
+void Constraint::SaveBinary(Base::OutputStream& str) const
+{
+    str << static_cast<uint32_t>(Name.size());
+    str.write(Name.c_str(), static_cast<int>(Name.size()));
+
+    str << static_cast<int32_t>(Type) << static_cast<int32_t>(AlignmentType)
+        << static_cast<int32_t>(InternalAlignmentIndex) << Value << static_cast<int32_t>(First)
+        << static_cast<int32_t>(FirstPos) << static_cast<int32_t>(Second)
+        << static_cast<int32_t>(SecondPos) << static_cast<int32_t>(Third)
+        << static_cast<int32_t>(ThirdPos) << LabelDistance << LabelPosition << isDriving
+        << isInVirtualSpace << isActive;
+}
+
+void Constraint::RestoreBinary(Base::InputStream& str)
+{
+    // same layout as the strings of the geometry list, with a checked length
+    Name = Part::GeometryPersistenceExtension::readString(str);
+
+    int32_t type {}, alignmentType {}, alignmentIndex {};
+    int32_t first {}, firstPos {}, second {}, secondPos {}, third {}, thirdPos {};
+    str >> type >> alignmentType >> alignmentIndex >> Value >> first >> firstPos >> second
+        >> secondPos >> third >> thirdPos >> LabelDistance >> LabelPosition >> isDriving
+        >> isInVirtualSpace >> isActive;
+    if (!str) {
+        throw Base::RestoreError("Unexpected end of binary constraint data");
+    }
+
+    Type = static_cast<ConstraintType>(type);
+    AlignmentType = static_cast<InternalAlignmentType>(alignmentType);
+    InternalAlignmentIndex = alignmentIndex;
+    First = first;
+    FirstPos = static_cast<PointPos>(firstPos);
+    Second = second;
+    SecondPos = static_cast<PointPos>(secondPos);
+    Third = third;
+    ThirdPos = static_cast<PointPos>(thirdPos);
+}
+
 void Constraint::substituteIndex(int fromGeoId, int toGeoId)
 {
     if (this->First == fromGeoId) {
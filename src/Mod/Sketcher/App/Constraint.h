@@ -32,6 +32,11 @@
 
 #include "GeoEnum.h"
 
+namespace Base
+{
+class InputStream;
+class OutputStream;
+}  // namespace Base
 
 namespace Sketcher
 {
@@ -111,6 +116,10 @@ public:
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
 
+    /// compact form used by PropertyConstraintList when saving to a binary file
+    void SaveBinary(Base::OutputStream& str) const;
+    void RestoreBinary(Base::InputStream& str);
+
     PyObject* getPyObject() override;
 
     Base::Quantity getPresentationValue() const;
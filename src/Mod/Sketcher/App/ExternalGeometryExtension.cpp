@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Writer.h>
 
 #include "ExternalGeometryExtension.h"
@@ -66,6 +67,26 @@ void ExternalGeometryExtension::saveAttributes(Base::Writer& writer) const
     }
 }
 
+void ExternalGeometryExtension::SaveBinary(Base::OutputStream& str) const
+{
+    Part::GeometryPersistenceExtension::SaveBinary(str);
+
+    writeString(str, Ref);
+    str << static_cast<int32_t>(RefIndex) << static_cast<uint32_t>(Flags.to_ulong());
+}
+
+void ExternalGeometryExtension::RestoreBinary(Base::InputStream& str)
+{
+    Part::GeometryPersistenceExtension::RestoreBinary(str);
+
+    Ref = readString(str);
+    int32_t refIndex {};
+    uint32_t flags {};
+    str >> refIndex >> flags;
+    RefIndex = refIndex;
+    Flags = FlagType(flags);
+}
+
 void ExternalGeometryExtension::preSave(Base::Writer& writer) const
 {
     if (Ref.size()) {
@@ -95,6 +95,13 @@ public:
 
     PyObject* getPyObject() override;
 
+    bool hasBinaryFormat() const override
+    {
+        return true;
+    }
+    void SaveBinary(Base::OutputStream& str) const override;
+    void RestoreBinary(Base::InputStream& str) override;
+
     // START_CREDIT_BLOCK: Credit under LGPL for this block to Zheng, Lei (realthunder)
     // <realthunder.dev@gmail.com>
     bool testFlag(int flag) const override
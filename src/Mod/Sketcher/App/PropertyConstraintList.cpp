@@ -22,13 +22,17 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <cassert>
 #endif
 
+#include <App/DocumentObject.h>
 #include <App/ExpressionParser.h>
 #include <App/ObjectIdentifier.h>
+#include <Base/Console.h>
 #include <Base/QuantityPy.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Tools.h>
 #include <Base/Writer.h>
 
@@ -326,6 +330,12 @@ void PropertyConstraintList::setPyObject(PyObject* value)
 
 void PropertyConstraintList::Save(Writer& writer) const
 {
+    if (writer.getMode("BinaryGeometry") && !writer.isForceXML() && getSize() > 0) {
+        writer.Stream() << writer.ind() << "<ConstraintList count=\"" << getSize() << "\" file=\""
+                        << writer.addFile(getName(), this) << "\"/>" << endl;
+        return;
+    }
+
     writer.Stream() << writer.ind() << "<ConstraintList count=\"" << getSize() << "\">" << endl;
     writer.incInd();
     for (int i = 0; i < getSize(); i++) {
@@ -341,6 +351,11 @@ void PropertyConstraintList::Restore(Base::XMLReader& reader)
     reader.readElement("ConstraintList");
     // get the value of my attribute
     int count = reader.getAttributeAsInteger("count");
+    if (reader.hasAttribute("file")) {
+        // the constraints are stored in a binary file, see SaveDocFile()
+        reader.addFile(reader.getAttribute("file"), this);
+        return;
+    }
 
     std::vector<Constraint*> values;
     values.reserve(count);
@@ -363,6 +378,65 @@ void PropertyConstraintList::Restore(Base::XMLReader& reader)
     setValues(std::move(values));
 }
 
+// Binary format, version 1: uint32 version, uint32 count, count x Constraint::SaveBinary()
+void PropertyConstraintList::SaveDocFile(Base::Writer& writer) const
+{
+    Base::OutputStream str(writer.Stream());
+    str << static_cast<uint32_t>(1) << static_cast<uint32_t>(getSize());
+    for (auto constraint : _lValueList) {
+        constraint->SaveBinary(str);
+    }
+}
+
+void PropertyConstraintList::RestoreDocFile(Base::Reader& reader)
+{
+    Base::InputStream str(reader);
+    uint32_t version = 0;
+    uint32_t count = 0;
+    str >> version >> count;
+    if (version != 1) {
+        Base::Console().Error("PropertyConstraintList: unsupported binary format version %u\n",
+                              version);
+        return;
+    }
+
+    std::vector<Constraint*> values;
+    // the count comes from the file, so don't trust it for the allocation
+    values.reserve(std::min<uint32_t>(count, 1024));
+    for (uint32_t i = 0; i < count; i++) {
+        Constraint* newC = new Constraint();
+        try {
+            newC->RestoreBinary(str);
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().Error("PropertyConstraintList: failed to restore constraint %u: %s\n",
+                                  i,
+                                  e.what());
+            delete newC;
+            break;
+        }
+        // To keep upward compatibility ignore unknown constraint types
+        if (newC->Type < Sketcher::NumConstraintTypes) {
+            values.push_back(newC);
+        }
+        else {
+            delete newC;
+        }
+    }
+
+    // The files are read after the owner has left its restoring state. Apply the values under
+    // that state as Restore() does, so that the owner doesn't take them for a user edit.
+    auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
+    if (owner && !owner->isRestoring()) {
+        Base::ObjectStatusLocker<App::ObjectStatus, App::DocumentObject> restoring(
+            App::ObjectStatus::Restore, owner);
+        setValues(std::move(values));
+    }
+    else {
+        setValues(std::move(values));
+    }
+}
+
 Property* PropertyConstraintList::Copy() const
 {
     PropertyConstraintList* p = new PropertyConstraintList();
@@ -73,6 +73,9 @@ Sketch::Sketch()
     , resolveAfterGeometryUpdated(false)
     , GCSsys()
     , ConstraintsCounter(0)
+    , SetUpExtGeoCount(0)
+    , SetUpReusable(false)
+    , FullSetUpCount(0)
     , isInitMove(false)
     , isFine(true)
     , moveStep(0)
@@ -143,6 +146,9 @@ void Sketch::clear()
     Redundant.clear();
     PartiallyRedundant.clear();
     MalformedConstraints.clear();
+
+    SetUpConstraints.clear();
+    SetUpReusable = false;
 }
 
 bool Sketch::analyseBlockedGeometry(const std::vector<Part::Geometry*>& internalGeoList,
@@ -199,7 +205,21 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
 {
     Base::TimeElapsed start_time;
 
+    if (canUpdateSketch(GeoList, ConstraintList, extGeoCount)) {
+        int dofs = updateSketch(ConstraintList);
+
+        if (debugMode == GCS::Minimal || debugMode == GCS::IterationLevel) {
+            Base::TimeElapsed end_time;
+
+            Base::Console().Log("Sketcher::setUpSketch()-Datums-T:%s\n",
+                                Base::TimeElapsed::diffTime(start_time, end_time).c_str());
+        }
+
+        return dofs;
+    }
+
     clear();
+    FullSetUpCount++;
 
     std::vector<Part::Geometry*> intGeoList, extGeoList;
     for (int i = 0; i < int(GeoList.size()) - extGeoCount; i++) {
@@ -338,6 +358,8 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
 
     calculateDependentParametersElements();
 
+    storeSetUp(ConstraintList, extGeoCount, doesBlockAffectOtherConstraints);
+
     if (debugMode == GCS::Minimal || debugMode == GCS::IterationLevel) {
         Base::TimeElapsed end_time;
 
@@ -348,6 +370,115 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
     return GCSsys.dofsNumber();
 }
 
+bool Sketch::isPlainDatum(const Constraint* constr)
+{
+    switch (constr->Type) {
+        case DistanceX:
+        case DistanceY:
+        case Distance:
+        case Radius:
+        case Diameter:
+        case Weight:
+            return true;
+        case Angle:
+            // angle-via-point stores an offset angle in the solver
+            return constr->Third == GeoEnum::GeoUndef;
+        default:
+            return false;
+    }
+}
+
+void Sketch::storeSetUp(const std::vector<Constraint*>& ConstraintList,
+                        int extGeoCount,
+                        bool doesBlockAffectOtherConstraints)
+{
+    SetUpConstraints.clear();
+    SetUpConstraints.reserve(ConstraintList.size());
+    for (auto constr : ConstraintList) {
+        SetUpConstraints.emplace_back(constr->clone());
+    }
+    SetUpExtGeoCount = extGeoCount;
+
+    // The diagnosis of redundant and conflicting constraints depends on whether the constraints
+    // are satisfied, i.e. on the datum values. The block constraint post-analysis changes the
+    // unknowns after the diagnosis. In those cases every solve needs a full set up.
+    SetUpReusable = !doesBlockAffectOtherConstraints && Conflicting.empty() && Redundant.empty()
+        && PartiallyRedundant.empty() && MalformedConstraints.empty() && !Geoms.empty();
+}
+
+bool Sketch::canUpdateSketch(const std::vector<Part::Geometry*>& GeoList,
+                             const std::vector<Constraint*>& ConstraintList,
+                             int extGeoCount) const
+{
+    if (!SetUpReusable || isInitMove || extGeoCount != SetUpExtGeoCount
+        || GeoList.size() != Geoms.size() || ConstraintList.size() != SetUpConstraints.size()) {
+        return false;
+    }
+
+    // The geometry must match the current solver state, which is the case when the
+    // SketchObject has taken over the result of the last solve.
+    for (std::size_t i = 0; i < GeoList.size(); i++) {
+        const Part::Geometry* geo = GeoList[i];
+        const Part::Geometry* solved = Geoms[i].geo;
+        if (geo->getTypeId() != solved->getTypeId()
+            || GeometryFacade::getBlocked(geo) != GeometryFacade::getBlocked(solved)
+            || GeometryFacade::getInternalType(geo) != GeometryFacade::getInternalType(solved)
+            || !geo->isSame(*solved, Precision::Confusion() * 1e-3, Precision::Angular() * 1e-3)) {
+            return false;
+        }
+    }
+
+    for (std::size_t i = 0; i < ConstraintList.size(); i++) {
+        const Constraint* constr = ConstraintList[i];
+        const Constraint* old = SetUpConstraints[i].get();
+        if (constr->Type != old->Type || constr->AlignmentType != old->AlignmentType
+            || constr->InternalAlignmentIndex != old->InternalAlignmentIndex
+            || constr->First != old->First || constr->FirstPos != old->FirstPos
+            || constr->Second != old->Second || constr->SecondPos != old->SecondPos
+            || constr->Third != old->Third || constr->ThirdPos != old->ThirdPos
+            || constr->isDriving != old->isDriving || constr->isActive != old->isActive) {
+            return false;
+        }
+
+        // values of other constraint types are transformed or act as solver unknowns
+        if (constr->getValue() != old->getValue() && (!constr->isDriving || !isPlainDatum(constr))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int Sketch::updateSketch(const std::vector<Constraint*>& ConstraintList)
+{
+    // Constrs holds the constraints in the order they were added by addConstraints()
+    auto constrDef = Constrs.begin();
+    for (std::size_t i = 0; i < ConstraintList.size(); i++) {
+        Constraint* constr = ConstraintList[i];
+        if (constr->Type == Block || !constr->isActive) {
+            continue;
+        }
+        if (constrDef == Constrs.end()) {
+            break;
+        }
+
+        // the SketchObject replaces constraints when changing them, so the pointer is refreshed
+        constrDef->constr = constr;
+        if (constrDef->driving && constrDef->value && isPlainDatum(constr)) {
+            *(constrDef->value) = constr->getValue();
+        }
+        SetUpConstraints[i]->setValue(constr->getValue());
+        ++constrDef;
+    }
+
+    // The Jacobian does not depend on the driving datum values, so the diagnosis of the
+    // unchanged geometry is still valid and initSolution() only repartitions the system.
+    clearTemporaryConstraints();
+    GCSsys.initSolution(defaultSolverRedundant);
+
+    return GCSsys.dofsNumber();
+}
+
 void Sketch::buildInternalAlignmentGeometryMap(const std::vector<Constraint*>& constraintList)
 {
     for (auto* c : constraintList) {
@@ -73,6 +73,10 @@ public:
      * an over-constrained sketch will always contain conflicting constraints
      * a fully constrained or under-constrained sketch may contain conflicting
      * constraints or may not
+     *
+     * if the geometry and the constraint structure are unchanged since the last set up and
+     * only datum values differ, the existing solver system is kept and only the datums are
+     * updated (see canUpdateSketch())
      */
     int setUpSketch(const std::vector<Part::Geometry*>& GeoList,
                     const std::vector<Constraint*>& ConstraintList,
@@ -146,6 +150,12 @@ public:
         return MalformedConstraints;
     }
 
+    /// number of times setUpSketch() rebuilt the solver system instead of reusing it
+    inline int getFullSetUpCount() const
+    {
+        return FullSetUpCount;
+    }
+
 public:
     std::set<std::pair<int, Sketcher::PointPos>> getDependencyGroup(int geoId, PointPos pos) const;
 
@@ -579,6 +589,13 @@ private:
     std::vector<int> PartiallyRedundant;
     std::vector<int> MalformedConstraints;
 
+    // copies of the constraints of the last set up, to detect when only datum values changed
+    std::vector<std::unique_ptr<Constraint>> SetUpConstraints;
+    int SetUpExtGeoCount;
+    // the last set up left the solver in a state that can be reused by updateSketch()
+    bool SetUpReusable;
+    int FullSetUpCount;
+
     std::vector<double*> pDependentParametersList;
 
     // map of geoIds to corresponding solverextensions. This is useful when solved geometry is NOT
@@ -740,6 +757,19 @@ private:
 
     void buildInternalAlignmentGeometryMap(const std::vector<Constraint*>& constraintList);
 
+    /// true if the solver system of the last set up can be reused for the given input
+    bool canUpdateSketch(const std::vector<Part::Geometry*>& GeoList,
+                         const std::vector<Constraint*>& ConstraintList,
+                         int extGeoCount) const;
+    /// updates the datum values of the existing solver system and reinitialises the solution
+    int updateSketch(const std::vector<Constraint*>& ConstraintList);
+    /// stores what is needed by canUpdateSketch() after a full set up
+    void storeSetUp(const std::vector<Constraint*>& ConstraintList,
+                    int extGeoCount,
+                    bool doesBlockAffectOtherConstraints);
+    /// datum constraints whose value is handed unmodified to the solver
+    static bool isPlainDatum(const Constraint* constr);
+
     int internalSolve(std::string& solvername, int level = 0);
 
     /// checks if the index bounds and converts negative indices to positive
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Writer.h>
 #include <Mod/Sketcher/App/SketchGeometryExtensionPy.h>
 
@@ -91,6 +92,31 @@ void SketchGeometryExtension::saveAttributes(Base::Writer& writer) const
                     << "\" geometryLayer=\"" << GeometryLayer;
 }
 
+void SketchGeometryExtension::SaveBinary(Base::OutputStream& str) const
+{
+    Part::GeometryPersistenceExtension::SaveBinary(str);
+
+    str << static_cast<int64_t>(Id) << static_cast<int32_t>(InternalGeometryType)
+        << static_cast<uint64_t>(GeometryModeFlags.to_ullong())
+        << static_cast<int32_t>(GeometryLayer);
+}
+
+void SketchGeometryExtension::RestoreBinary(Base::InputStream& str)
+{
+    Part::GeometryPersistenceExtension::RestoreBinary(str);
+
+    int64_t id {};
+    int32_t internalType {};
+    uint64_t modeFlags {};
+    int32_t layer {};
+    str >> id >> internalType >> modeFlags >> layer;
+
+    Id = static_cast<long>(id);
+    InternalGeometryType = static_cast<InternalType::InternalType>(internalType);
+    GeometryModeFlags = GeometryModeFlagType(modeFlags);
+    GeometryLayer = layer;
+}
+
 void SketchGeometryExtension::preSave(Base::Writer& writer) const
 {
     writer.Stream() << " id=\"" << Id << "\"";
@@ -99,6 +99,13 @@ public:
 
     PyObject* getPyObject() override;
 
+    bool hasBinaryFormat() const override
+    {
+        return true;
+    }
+    void SaveBinary(Base::OutputStream& str) const override;
+    void RestoreBinary(Base::InputStream& str) override;
+
     long getId() const override
     {
         return Id;
@@ -24,6 +24,7 @@
 
 #include <Base/Exception.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Writer.h>
 
 #include <Mod/Sketcher/Gui/ViewProviderSketchGeometryExtensionPy.h>
@@ -80,6 +81,22 @@ void ViewProviderSketchGeometryExtension::saveAttributes(Base::Writer& writer) c
     writer.Stream() << "\" visualLayerId=\"" << VisualLayerId;
 }
 
+void ViewProviderSketchGeometryExtension::SaveBinary(Base::OutputStream& str) const
+{
+    Part::GeometryPersistenceExtension::SaveBinary(str);
+
+    str << static_cast<int32_t>(VisualLayerId);
+}
+
+void ViewProviderSketchGeometryExtension::RestoreBinary(Base::InputStream& str)
+{
+    Part::GeometryPersistenceExtension::RestoreBinary(str);
+
+    int32_t visualLayerId {};
+    str >> visualLayerId;
+    VisualLayerId = visualLayerId;
+}
+
 
 PyObject* ViewProviderSketchGeometryExtension::getPyObject()
 {
@@ -43,6 +43,13 @@ public:
 
     PyObject* getPyObject() override;
 
+    bool hasBinaryFormat() const override
+    {
+        return true;
+    }
+    void SaveBinary(Base::OutputStream& str) const override;
+    void RestoreBinary(Base::InputStream& str) override;
+
     // Data Members
 
     // Representation factor
@@ -20,6 +20,7 @@
 
 #include "PreCompiled.h"
 
+#include <App/Application.h>
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 #include <Base/PyObjectBase.h>
@@ -56,6 +57,7 @@
 #include "DrawViewSymbol.h"
 #include "DrawWeldSymbol.h"
 #include "FeatureProjection.h"
+#include "HLRCache.h"
 #include "LandmarkDimension.h"
 #include "PropertyCenterLineList.h"
 #include "PropertyCosmeticEdgeList.h"
@@ -151,5 +153,10 @@ PyMOD_INIT_FUNC(TechDraw)
 
     TechDraw::LineFormat::initCurrentLineFormat();
 
+    // the cached HLR results keep the shapes of a closed document alive
+    App::GetApplication().signalDeleteDocument.connect([](const App::Document&) {
+        TechDraw::HLRCache::instance().clear();
+    });
+
     PyMOD_Return(mod);
 }
@@ -315,7 +315,25 @@ GeometryObjectPtr DrawViewPart::makeGeometryForShape(TopoDS_Shape& shape)
     m_saveCentroid = DU::toVector3d(gCentroid);
     m_saveShape = centerScaleRotate(this, localShape, m_saveCentroid);
 
-    return buildGeometryObject(localShape, getProjectionCS());
+    // the copy made above has new TShapes, so the cache key has to be built from the
+    // original shape.
+    m_hlrCacheKey = makeHlrCacheKey(shape);
+    GeometryObjectPtr go = buildGeometryObject(localShape, getProjectionCS());
+    m_hlrCacheKey = HLRCacheKey();
+    return go;
+}
+
+//! identify the HLR job for shape by its source and everything that is applied to it before
+//! projection, so that other views of the same source can reuse the result.
+HLRCacheKey DrawViewPart::makeHlrCacheKey(const TopoDS_Shape& shape) const
+{
+    std::vector<double> options {getScale(),
+                                 Rotation.getValue(),
+                                 static_cast<double>(IsoCount.getValue()),
+                                 Perspective.getValue() ? 1.0 : 0.0,
+                                 Focus.getValue(),
+                                 CoarseView.getValue() ? 1.0 : 0.0};
+    return HLRCacheKey(shape, getProjectionCS(), options);
 }
 
 //! Modify a shape by centering, scaling and rotating and return the centered (but not rotated) shape
@@ -351,6 +369,7 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     go->setFocus(Focus.getValue());
     go->usePolygonHLR(CoarseView.getValue());
     go->setScrubCount(ScrubCount.getValue());
+    go->setHlrCacheKey(m_hlrCacheKey);
 
     if (CoarseView.getValue()) {
         //the polygon approximation HLR process runs quickly, so doesn't need to be in a
@@ -369,7 +388,8 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         // This is important because those variables might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
-        m_hlrFuture = QtConcurrent::run(std::move(lambda));
+        // The shared pool limits how many HLR jobs run at once when many views update together.
+        m_hlrFuture = QtConcurrent::run(HLRCache::threadPool(), std::move(lambda));
         m_hlrWatcher.setFuture(m_hlrFuture);
         waitingForHlr(true);
     }
@@ -39,6 +39,7 @@
 
 #include "CosmeticExtension.h"
 #include "DrawView.h"
+#include "HLRCache.h"
 
 
 class gp_Pnt;
@@ -230,6 +231,7 @@ protected:
     virtual TechDraw::GeometryObjectPtr buildGeometryObject(TopoDS_Shape& shape,
                                                             const gp_Ax2& viewAxis);
     virtual TechDraw::GeometryObjectPtr makeGeometryForShape(TopoDS_Shape& shape);//const??
+    HLRCacheKey makeHlrCacheKey(const TopoDS_Shape& shape) const;
     void partExec(TopoDS_Shape& shape);
     virtual void addPoints(void);
 
@@ -245,6 +247,7 @@ protected:
     Base::Vector3d m_saveCentroid;//centroid before centering shape in origin
 
     std::vector<TechDraw::VertexPtr> m_referenceVerts;
+    HLRCacheKey m_hlrCacheKey;//set while building the geometry object for a cacheable shape
 
 private:
     bool nowUnsetting;
@@ -73,6 +73,7 @@
 #include "DrawViewDetail.h"
 #include "DrawViewPart.h"
 #include "GeometryObject.h"
+#include "HLRCache.h"
 #include "DrawProjectSplit.h"
 #include "ShapeUtils.h"
 
@@ -143,7 +144,64 @@ void GeometryObject::clear()
 void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis)
 {
     clear();
+    projectWithCache([&] { runExactHlr(inShape, viewAxis); });
+    makeTDGeometry();
+}
+
+//! reuse the HLR output of an earlier projection with the same key if there is one, otherwise
+//! run the hidden line removal and make the output available to later projections.
+void GeometryObject::projectWithCache(const std::function<void()>& runHlr)
+{
+    HLRCache& cache = HLRCache::instance();
+    HLRResultPtr cached = cache.acquire(m_hlrCacheKey);
+    if (cached) {
+        setHlrResult(*cached);
+        return;
+    }
+
+    try {
+        runHlr();
+    }
+    catch (...) {
+        cache.abandon(m_hlrCacheKey);
+        throw;
+    }
+    cache.store(m_hlrCacheKey, std::make_shared<HLRResult>(getHlrResult()));
+}
+
+HLRResult GeometryObject::getHlrResult() const
+{
+    HLRResult result;
+    result.visHard = visHard;
+    result.visOutline = visOutline;
+    result.visSmooth = visSmooth;
+    result.visSeam = visSeam;
+    result.visIso = visIso;
+    result.hidHard = hidHard;
+    result.hidOutline = hidOutline;
+    result.hidSmooth = hidSmooth;
+    result.hidSeam = hidSeam;
+    result.hidIso = hidIso;
+    return result;
+}
 
+void GeometryObject::setHlrResult(const HLRResult& result)
+{
+    visHard = result.visHard;
+    visOutline = result.visOutline;
+    visSmooth = result.visSmooth;
+    visSeam = result.visSeam;
+    visIso = result.visIso;
+    hidHard = result.hidHard;
+    hidOutline = result.hidOutline;
+    hidSmooth = result.hidSmooth;
+    hidSeam = result.hidSeam;
+    hidIso = result.hidIso;
+}
+
+//! run the exact HLR algorithm on inShape and keep its output compounds
+void GeometryObject::runExactHlr(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis)
+{
     Handle(HLRBRep_Algo) brep_hlr;
     try {
         brep_hlr = new HLRBRep_Algo();
@@ -243,8 +301,6 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
         throw Base::RuntimeError(
             "GeometryObject::projectShape - unknown error occurred while extracting edges");
     }
-
-    makeTDGeometry();
 }
 
 //convert the hlr output into TD Geometry
@@ -292,7 +348,13 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
 //    Base::Console().Message("GO::projectShapeWithPolygonAlgo()\n");
     // Clear previous Geometry
     clear();
+    projectWithCache([&] { runPolygonHlr(input, viewAxis); });
+    makeTDGeometry();
+}
 
+//! run the polygon approximation HLR algorithm on input and keep its output compounds
+void GeometryObject::runPolygonHlr(const TopoDS_Shape& input, const gp_Ax2& viewAxis)
+{
     //work around for Mantis issue #3332
     //if 3332 gets fixed in OCC, this will produce shifted views and will need
     //to be reverted.
@@ -387,8 +449,6 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
         throw Base::RuntimeError("GeometryObject::projectShapeWithPolygonAlgo - unknown error "
                                  "occurred while extracting edges");
     }
-
-    makeTDGeometry();
 }
 
 //project the edges in shape onto XY.mirrored plane of CS.  mimics the projection
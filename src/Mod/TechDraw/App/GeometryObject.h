@@ -29,6 +29,7 @@
 
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -41,6 +42,7 @@
 #include <Base/Vector3D.h>
 
 #include "Geometry.h"
+#include "HLRCache.h"
 #include "ShapeUtils.h"
 
 
@@ -98,6 +100,11 @@ public:
     void setFocus(double f) { m_focus = f; }
     double getFocus() { return m_focus; }
     void setScrubCount(int count) { m_scrubCount = count; }
+    //! results of projections with a valid key are shared through HLRCache
+    void setHlrCacheKey(const HLRCacheKey& key) { m_hlrCacheKey = key; }
+
+    HLRResult getHlrResult() const;
+    void setHlrResult(const HLRResult& result);
 
 
     void pruneVertexGeom(Base::Vector3d center, double radius);
@@ -141,6 +148,10 @@ protected:
     TopoDS_Shape hidSeam;
     TopoDS_Shape hidIso;
 
+    void projectWithCache(const std::function<void()>& runHlr);
+    void runExactHlr(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis);
+    void runPolygonHlr(const TopoDS_Shape& input, const gp_Ax2& viewAxis);
+
     void addGeomFromCompound(TopoDS_Shape edgeCompound, edgeClass category, bool visible);
     TechDraw::DrawViewDetail* isParentDetail();
 
@@ -165,6 +176,7 @@ protected:
     double m_focus;
     bool m_usePolygonHLR;
     int m_scrubCount;
+    HLRCacheKey m_hlrCacheKey;
 };
 
 using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <QThread>
+#include <QThreadPool>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <gp_Trsf.hxx>
+#endif
+
+#include <functional>
+
+#include "HLRCache.h"
+#include "Preferences.h"
+
+using namespace TechDraw;
+
+namespace
+{
+// copied from boost::hash_combine
+template<typename T>
+void hashCombine(std::size_t& seed, const T& value)
+{
+    seed ^= std::hash<T> {}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+}// namespace
+
+HLRCacheKey::HLRCacheKey(const TopoDS_Shape& source, const gp_Ax2& viewAxis,
+                         const std::vector<double>& options)
+    : m_source(source)
+{
+    if (source.IsNull()) {
+        return;
+    }
+    addShape(source);
+
+    const gp_Pnt& origin = viewAxis.Location();
+    const gp_Dir& direction = viewAxis.Direction();
+    const gp_Dir& xDirection = viewAxis.XDirection();
+    for (const auto& xyz : {origin.XYZ(), direction.XYZ(), xDirection.XYZ()}) {
+        addValue(xyz.X());
+        addValue(xyz.Y());
+        addValue(xyz.Z());
+    }
+    for (double option : options) {
+        addValue(option);
+    }
+}
+
+//! compounds are usually rebuilt every time the source is extracted, so only their locations
+//! and the identities of their leaves are significant.
+void HLRCacheKey::addShape(const TopoDS_Shape& shape)
+{
+    const gp_Trsf& transform = shape.Location().Transformation();
+    for (int row = 1; row <= 3; ++row) {
+        for (int col = 1; col <= 4; ++col) {
+            addValue(transform.Value(row, col));
+        }
+    }
+    addValue(static_cast<double>(shape.Orientation()));
+
+    if (shape.ShapeType() == TopAbs_COMPOUND) {
+        for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+            addShape(it.Value());
+        }
+        return;
+    }
+
+    const void* identity = shape.TShape().get();
+    m_identities.push_back(identity);
+    hashCombine(m_hash, identity);
+}
+
+void HLRCacheKey::addValue(double value)
+{
+    m_values.push_back(value);
+    hashCombine(m_hash, value);
+}
+
+bool HLRCacheKey::operator==(const HLRCacheKey& other) const
+{
+    return m_hash == other.m_hash && m_identities == other.m_identities
+        && m_values == other.m_values;
+}
+
+
+HLRCache& HLRCache::instance()
+{
+    static HLRCache cache;
+    return cache;
+}
+
+//! jobs still queued or running at exit may use the cache, so let them finish first.
+HLRCache::~HLRCache()
+{
+    if (m_threadPool) {
+        m_threadPool->waitForDone();
+    }
+}
+
+HLRResultPtr HLRCache::acquire(const HLRCacheKey& key)
+{
+    if (!key.isValid() || Preferences::hlrCacheSize() == 0) {
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // another view may be projecting the same shape right now.  Wait for it rather than
+    // starting a second identical job.
+    m_pendingDone.wait(lock, [this, &key] { return m_pending.count(key) == 0; });
+
+    auto found = m_entries.find(key);
+    if (found != m_entries.end()) {
+        m_lru.splice(m_lru.begin(), m_lru, found->second.lruPosition);
+        return found->second.result;
+    }
+
+    m_pending.emplace(key, m_generation);
+    return nullptr;
+}
+
+void HLRCache::store(const HLRCacheKey& key, HLRResultPtr result)
+{
+    if (!key.isValid()) {
+        return;
+    }
+
+    std::size_t maxEntries = static_cast<std::size_t>(Preferences::hlrCacheSize());
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // a result started before the last clear() may belong to a closed document
+        bool current = true;
+        auto pending = m_pending.find(key);
+        if (pending != m_pending.end()) {
+            current = pending->second == m_generation;
+            m_pending.erase(pending);
+        }
+        if (maxEntries > 0 && result && current) {
+            auto found = m_entries.find(key);
+            if (found != m_entries.end()) {
+                found->second.result = std::move(result);
+                m_lru.splice(m_lru.begin(), m_lru, found->second.lruPosition);
+            }
+            else {
+                m_lru.push_front(key);
+                m_entries.emplace(key, Entry {std::move(result), m_lru.begin()});
+            }
+        }
+        trim(maxEntries);
+    }
+    m_pendingDone.notify_all();
+}
+
+//! the caller failed to produce a result for key.  Any waiting jobs will try for themselves.
+void HLRCache::abandon(const HLRCacheKey& key)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.erase(key);
+    }
+    m_pendingDone.notify_all();
+}
+
+void HLRCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_lru.clear();
+    ++m_generation;
+}
+
+std::size_t HLRCache::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+//! drop the least recently used entries.  Must be called with m_mutex held.
+void HLRCache::trim(std::size_t maxEntries)
+{
+    while (m_entries.size() > maxEntries) {
+        m_entries.erase(m_lru.back());
+        m_lru.pop_back();
+    }
+}
+
+QThreadPool* HLRCache::threadPool()
+{
+    HLRCache& cache = instance();
+    std::call_once(cache.m_threadPoolCreated, [&cache] {
+        cache.m_threadPool = std::make_unique<QThreadPool>();
+        int threads = Preferences::hlrThreadCount();
+        if (threads <= 0) {
+            threads = QThread::idealThreadCount();
+        }
+        cache.m_threadPool->setMaxThreadCount(std::max(1, threads));
+    });
+    return cache.m_threadPool.get();
+}
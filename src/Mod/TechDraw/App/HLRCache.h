@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef TECHDRAW_HLRCACHE_H
+#define TECHDRAW_HLRCACHE_H
+
+//! an application wide store of hidden line removal results, so that views of the same
+//! source shape with the same projection do not have to run HLR again.
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax2.hxx>
+
+class QThreadPool;
+
+namespace TechDraw
+{
+
+//! the raw output of one HLR run, before conversion to BaseGeom
+struct TechDrawExport HLRResult
+{
+    TopoDS_Shape visHard;
+    TopoDS_Shape visOutline;
+    TopoDS_Shape visSmooth;
+    TopoDS_Shape visSeam;
+    TopoDS_Shape visIso;
+    TopoDS_Shape hidHard;
+    TopoDS_Shape hidOutline;
+    TopoDS_Shape hidSmooth;
+    TopoDS_Shape hidSeam;
+    TopoDS_Shape hidIso;
+};
+
+using HLRResultPtr = std::shared_ptr<const HLRResult>;
+
+//! identifies a HLR job by the identity of its source shape (the TShapes and locations of
+//! the shape's top level pieces) and the parameters that affect the projection.  The key
+//! holds a reference to the source shape so the TShape addresses can not be recycled while
+//! the key is alive.
+class TechDrawExport HLRCacheKey
+{
+public:
+    HLRCacheKey() = default;
+    HLRCacheKey(const TopoDS_Shape& source, const gp_Ax2& viewAxis,
+                const std::vector<double>& options);
+
+    bool isValid() const { return !m_source.IsNull(); }
+    std::size_t hash() const { return m_hash; }
+
+    bool operator==(const HLRCacheKey& other) const;
+
+    struct Hasher
+    {
+        std::size_t operator()(const HLRCacheKey& key) const { return key.hash(); }
+    };
+
+private:
+    void addShape(const TopoDS_Shape& shape);
+    void addValue(double value);
+
+    TopoDS_Shape m_source;
+    std::vector<const void*> m_identities;
+    std::vector<double> m_values;
+    std::size_t m_hash {0};
+};
+
+class TechDrawExport HLRCache
+{
+public:
+    static HLRCache& instance();
+
+    //! returns the stored result for key.  If there is none, the caller is made responsible
+    //! for producing it and must follow up with store() or abandon().  If another thread is
+    //! already producing the result, this waits for it to finish.
+    HLRResultPtr acquire(const HLRCacheKey& key);
+    void store(const HLRCacheKey& key, HLRResultPtr result);
+    void abandon(const HLRCacheKey& key);
+
+    //! drop all stored results.  Results of jobs that are still running are not stored.
+    void clear();
+    std::size_t size() const;
+
+    //! the pool used to run HLR jobs.  Its size is capped by Preferences::hlrThreadCount().
+    static QThreadPool* threadPool();
+
+private:
+    HLRCache() = default;
+    ~HLRCache();
+
+    void trim(std::size_t maxEntries);
+
+    using KeyList = std::list<HLRCacheKey>;
+    struct Entry
+    {
+        HLRResultPtr result;
+        KeyList::iterator lruPosition;
+    };
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_pendingDone;
+    std::unordered_map<HLRCacheKey, Entry, HLRCacheKey::Hasher> m_entries;
+    //! keys being produced, with the value of m_generation when they were acquired
+    std::unordered_map<HLRCacheKey, unsigned int, HLRCacheKey::Hasher> m_pending;
+    unsigned int m_generation {0};
+    KeyList m_lru;  // most recently used at front
+
+    std::once_flag m_threadPoolCreated;
+    std::unique_ptr<QThreadPool> m_threadPool;
+};
+
+}// namespace TechDraw
+
+#endif// TECHDRAW_HLRCACHE_H
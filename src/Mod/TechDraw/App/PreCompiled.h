@@ -62,6 +62,8 @@
 #include <QLocale>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QThread>
+#include <QThreadPool>
 #include <QtConcurrentRun>
 
 // OpenCasCade
@@ -682,3 +682,17 @@ bool Preferences::useLegacySvgScaling()
 {
     return getPreferenceGroup("General")->GetBool("LegacySvgScaling", false);
 }
+
+//! the number of hidden line removal results kept for reuse by views of the same shape.
+//! 0 disables the cache.
+int Preferences::hlrCacheSize()
+{
+    return std::max(0, static_cast<int>(getPreferenceGroup("General")->GetInt("HlrCacheSize", 32)));
+}
+
+//! the maximum number of hidden line removal jobs allowed to run at the same time.
+//! 0 means use one thread per core.
+int Preferences::hlrThreadCount()
+{
+    return std::max(0, static_cast<int>(getPreferenceGroup("General")->GetInt("HlrThreadCount", 0)));
+}
@@ -159,6 +159,9 @@ public:
 
     static bool useLegacySvgScaling();
 
+    static int hlrCacheSize();
+    static int hlrThreadCount();
+
 };
 
 
@@ -55,3 +55,52 @@ class TestGuiDocument(unittest.TestCase):
         # Check if the new function returns the correct root objects
         expected_root_objects = [group1, group2, obj1, part1]
         self.assertEqual(set(root_objects), set(expected_root_objects))
+
+    def testSelectionBatch(self):
+        class BatchObserver:
+            def __init__(self):
+                self.batches = []
+                self.added = 0
+
+            def addSelection(self, doc, obj, sub, pnt):
+                self.added += 1
+
+            def selectionBatch(self, changes):
+                self.batches.append(changes)
+
+        objs = [self.doc.addObject("App::FeaturePython", "Obj") for _ in range(10)]
+        FreeCADGui.Selection.clearSelection()
+        observer = BatchObserver()
+        FreeCADGui.Selection.addObserver(observer)
+        try:
+            FreeCADGui.Selection.beginBatch()
+            try:
+                for obj in objs:
+                    FreeCADGui.Selection.addSelection(self.doc.Name, obj.Name)
+                self.assertEqual(observer.batches, [])
+            finally:
+                FreeCADGui.Selection.endBatch()
+
+            # all the additions arrive in one notification
+            self.assertEqual(len(observer.batches), 1)
+            self.assertEqual(
+                [change for change in observer.batches[0] if change[0] == "addSelection"],
+                [("addSelection", self.doc.Name, obj.Name, "") for obj in objs],
+            )
+            self.assertEqual(observer.added, 0)
+            self.assertEqual(len(FreeCADGui.Selection.getSelection(self.doc.Name)), len(objs))
+
+            # an addition undone in the same batch is not reported at all
+            extra = self.doc.addObject("App::FeaturePython", "Extra")
+            FreeCADGui.Selection.beginBatch()
+            FreeCADGui.Selection.addSelection(self.doc.Name, extra.Name)
+            FreeCADGui.Selection.removeSelection(self.doc.Name, extra.Name)
+            FreeCADGui.Selection.endBatch()
+            self.assertFalse(
+                any(change[2] == extra.Name for batch in observer.batches for change in batch)
+            )
+
+            self.assertRaises(RuntimeError, FreeCADGui.Selection.endBatch)
+        finally:
+            FreeCADGui.Selection.removeObserver(observer)
+            FreeCADGui.Selection.clearSelection()
@@ -3,11 +3,13 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <sstream>
 #include <boost/core/ignore_unused.hpp>
 
 #include <App/Application.h>
 #include <App/ComplexGeoData.h>
 #include <Base/BoundBox.h>
+#include <Base/Reader.h>
 #include <Base/Writer.h>
 #include <src/App/InitApplication.h>
 
@@ -470,6 +472,53 @@ TEST_F(ComplexGeoDataTest, saveDocFileWithElementMap)
 TEST_F(ComplexGeoDataTest, restoreStream)
 {}
 
+TEST_F(ComplexGeoDataTest, restoreDocFileElementMapOnFirstUse)
+{
+    // Arrange
+    Base::StringWriter writer;
+    Data::MappedName mappedName;
+    Data::IndexedName indexedName;
+    std::tie(indexedName, mappedName) = createMappedName("SomeElement");
+    cgd().SaveDocFile(writer);
+    std::istringstream stream(writer.getString());
+    Base::Reader reader(stream, "test", 1);
+    ConcreteComplexGeoDataForTesting restored;
+
+    // Act
+    restored.RestoreDocFile(reader);
+
+    // Assert
+    EXPECT_TRUE(restored.hasElementMap());
+    EXPECT_TRUE(restored.hasPendingElementMap());
+    EXPECT_GT(restored.getMemSize(), 0);
+    EXPECT_TRUE(restored.hasPendingElementMap());
+    EXPECT_EQ(restored.getElementMapSize(), 1);
+    EXPECT_FALSE(restored.hasPendingElementMap());
+    EXPECT_FALSE(restored.isRestoreFailed());
+    EXPECT_EQ(restored.getMappedName(indexedName), mappedName);
+}
+
+TEST_F(ComplexGeoDataTest, restoreDocFileElementMapFailureOnFirstUse)
+{
+    // Arrange
+    std::istringstream stream("BeginElementMap v1\nnot an element map\n");
+    Base::Reader reader(stream, "test", 1);
+    ConcreteComplexGeoDataForTesting restored;
+    restored.RestoreDocFile(reader);
+    ASSERT_TRUE(restored.hasPendingElementMap());
+    ASSERT_FALSE(restored.isRestoreFailed());
+
+    // Act
+    auto size = restored.getElementMapSize();
+
+    // Assert
+    EXPECT_EQ(size, 0);
+    EXPECT_FALSE(restored.hasPendingElementMap());
+    EXPECT_TRUE(restored.isRestoreFailed());
+    restored.resetRestoreFailure();
+    EXPECT_FALSE(restored.isRestoreFailed());
+}
+
 TEST_F(ComplexGeoDataTest, traceElement)
 {  // This test barely scratches the surface; see the ToposhapeExtension traceElement test for more
     Data::MappedName mappedName;
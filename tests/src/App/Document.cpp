@@ -5,6 +5,7 @@
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/FeatureTest.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -24,12 +25,37 @@ class FakeWriter: public Base::Writer
     }
 };
 
+namespace DocumentTests
+{
+/// A feature that touches another object when it is recomputed
+class TouchingFeature: public App::FeatureTest
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(DocumentTests::TouchingFeature);
+
+public:
+    App::DocumentObjectExecReturn* execute() override
+    {
+        if (toTouch) {
+            toTouch->touch();
+        }
+        return App::FeatureTest::execute();
+    }
+
+    App::DocumentObject* toTouch {};
+};
+
+PROPERTY_SOURCE(DocumentTests::TouchingFeature, App::FeatureTest)
+}  // namespace DocumentTests
+
 class DocumentTest: public ::testing::Test
 {
 protected:
     static void SetUpTestSuite()
     {
         tests::initApplication();
+        if (DocumentTests::TouchingFeature::getClassTypeId().isBad()) {
+            DocumentTests::TouchingFeature::init();
+        }
     }
 
     void SetUp() override
@@ -94,4 +120,85 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, getDependencyListFollowsLinksAddedOutOfOrder)
+{
+    // Arrange
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    auto third = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Third"));
+
+    // Act
+    first->Link.setValue(second);
+    second->Link.setValue(third);
+    auto deps = doc()->getDependencyList({first}, App::Document::DepSort);
+
+    // Assert
+    std::vector<App::DocumentObject*> expected {third, second, first};
+    EXPECT_EQ(deps, expected);
+}
+
+TEST_F(DocumentTest, getDependencyListRecoversAfterCycleIsBroken)
+{
+    // Arrange
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    first->Link.setValue(second);
+    second->Link.setValue(first);
+    EXPECT_EQ(doc()->getDependencyList({first}, App::Document::DepSort).size(), 2);
+
+    // Act
+    first->Link.setValue(nullptr);
+    auto deps = doc()->getDependencyList({second}, App::Document::DepSort);
+
+    // Assert
+    std::vector<App::DocumentObject*> expected {first, second};
+    EXPECT_EQ(deps, expected);
+}
+
+TEST_F(DocumentTest, recomputeVisitsObjectsTouchedDuringRecompute)
+{
+    // Arrange
+    auto first = static_cast<DocumentTests::TouchingFeature*>(
+        doc()->addObject("DocumentTests::TouchingFeature", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    doc()->recompute();
+    first->toTouch = second;
+    first->touch();
+    int firstCount = first->ExecCount.getValue();
+    int secondCount = second->ExecCount.getValue();
+
+    // Act
+    doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(first->ExecCount.getValue(), firstCount + 1);
+    EXPECT_EQ(second->ExecCount.getValue(), secondCount + 1);
+    EXPECT_FALSE(second->isTouched());
+}
+
+TEST_F(DocumentTest, recomputeTouchedOnlySkipsObjectsTouchedDuringRecompute)
+{
+    // Arrange
+    auto first = static_cast<DocumentTests::TouchingFeature*>(
+        doc()->addObject("DocumentTests::TouchingFeature", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    auto third = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Third"));
+    third->Link.setValue(first);
+    doc()->recompute();
+    first->toTouch = second;
+    first->touch();
+    int firstCount = first->ExecCount.getValue();
+    int secondCount = second->ExecCount.getValue();
+    int thirdCount = third->ExecCount.getValue();
+
+    // Act
+    doc()->recompute({}, false, nullptr, App::Document::DepTouchedOnly);
+
+    // Assert -- the dependent is recomputed, the object touched on the way is not
+    EXPECT_EQ(first->ExecCount.getValue(), firstCount + 1);
+    EXPECT_EQ(third->ExecCount.getValue(), thirdCount + 1);
+    EXPECT_EQ(second->ExecCount.getValue(), secondCount);
+    EXPECT_TRUE(second->isTouched());
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -365,6 +365,28 @@ TEST_F(ParameterTest, TestSaveRestoreNoRef)
     cfg->exportTo(fn.c_str());
 }
 
+TEST_F(ParameterTest, TestCachedValues)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    EXPECT_EQ(grp->GetInt("Cached", 1), 1);
+    grp->SetInt("Cached", 5);
+    EXPECT_EQ(grp->GetInt("Cached", 1), 5);
+    grp->RemoveInt("Cached");
+    EXPECT_EQ(grp->GetInt("Cached", 1), 1);
+
+    grp->SetASCII("Text", "Value");
+    EXPECT_EQ(grp->GetASCII("Text", "None"), "Value");
+    grp->Clear(true);
+    EXPECT_EQ(grp->GetASCII("Text", "None"), "None");
+
+    auto sub = grp->GetGroup("Sub");
+    sub->SetFloat("Float", 1.5);
+    EXPECT_EQ(sub->GetFloat("Float", 0.0), 1.5);
+    grp->RemoveGrp("Sub");
+    EXPECT_EQ(sub->GetFloat("Float", 0.0), 0.0);
+}
+
 TEST_F(ParameterTest, TestGroupRef)
 {
     auto cfg = getCreateConfig();
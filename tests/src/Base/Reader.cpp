@@ -10,6 +10,7 @@
 #include "Base/Reader.h"
 #include <array>
 #include <boost/filesystem.hpp>
+#include <chrono>
 #include <fstream>
 #include <xercesc/util/PlatformUtils.hpp>
 
@@ -368,3 +369,89 @@ TEST_F(ReaderTest, invalidDefaults)
         { xml.Reader()->getAttributeAsInteger("missing", "Not a Float"); },
         std::invalid_argument);
 }
+
+TEST_F(ReaderTest, attributesOfSuccessiveElements)
+{
+    // Arrange
+    auto xmlBody = R"(
+<node1 a='1' b='2' c='3'/>
+<node2 b='two'/>
+<node3 name='Ünïcödé' value='ok'/>
+)";
+
+    ReaderXML xml;
+    xml.givenDataAsXMLStream(xmlBody);
+
+    // Act / Assert
+    xml.Reader()->readElement("node1");
+    EXPECT_EQ(xml.Reader()->getAttributeCount(), 3U);
+    EXPECT_STREQ(xml.Reader()->getAttribute("c"), "3");
+
+    xml.Reader()->readElement("node2");
+    EXPECT_EQ(xml.Reader()->getAttributeCount(), 1U);
+    EXPECT_FALSE(xml.Reader()->hasAttribute("a"));
+    EXPECT_FALSE(xml.Reader()->hasAttribute("c"));
+    EXPECT_STREQ(xml.Reader()->getAttribute("b"), "two");
+
+    xml.Reader()->readElement("node3");
+    EXPECT_EQ(xml.Reader()->getAttributeCount(), 2U);
+    EXPECT_EQ(std::string(xml.Reader()->getAttribute("name")), std::string("Ünïcödé"));
+    EXPECT_STREQ(xml.Reader()->getAttribute("value"), "ok");
+}
+
+TEST_F(ReaderTest, typedAttributes)
+{
+    // Arrange
+    auto xmlBody = R"(
+<node int='-42' unsigned='42' float='2.5e-3' huge='99999999999999999999999'/>
+)";
+
+    ReaderXML xml;
+    xml.givenDataAsXMLStream(xmlBody);
+    xml.Reader()->readElement("node");
+
+    // Act / Assert
+    EXPECT_EQ(xml.Reader()->getAttributeAsInteger("int"), -42);
+    EXPECT_EQ(xml.Reader()->getAttributeAsUnsigned("unsigned"), 42UL);
+    EXPECT_DOUBLE_EQ(xml.Reader()->getAttributeAsFloat("float"), 2.5e-3);
+    EXPECT_THROW({ xml.Reader()->getAttributeAsInteger("huge"); }, std::out_of_range);
+}
+
+TEST_F(ReaderTest, restorePropertiesBenchmark)
+{
+    // Arrange: a property container as written by Document::Save
+    const int numProperties = 100000;
+    std::ostringstream body;
+    body << "<Properties Count=\"" << numProperties << "\">\n";
+    for (int i = 0; i < numProperties; ++i) {
+        body << "<Property name=\"Cell" << i << "\" type=\"App::PropertyFloat\" status=\"1\">\n"
+             << "<Float value=\"" << i << ".25\"/>\n"
+             << "</Property>\n";
+    }
+    body << "</Properties>\n";
+
+    ReaderXML xml;
+    xml.givenDataAsXMLStream(body.str());
+
+    // Act
+    auto start = std::chrono::steady_clock::now();
+    xml.Reader()->readElement("Properties");
+    long count = xml.Reader()->getAttributeAsInteger("Count");
+    double sum = 0.0;
+    for (long i = 0; i < count; ++i) {
+        xml.Reader()->readElement("Property");
+        EXPECT_STREQ(xml.Reader()->getAttribute("type"), "App::PropertyFloat");
+        EXPECT_EQ(xml.Reader()->getAttributeAsUnsigned("status"), 1UL);
+        xml.Reader()->readElement("Float");
+        sum += xml.Reader()->getAttributeAsFloat("value");
+        xml.Reader()->readEndElement("Property");
+    }
+    xml.Reader()->readEndElement("Properties");
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    RecordProperty("RestoreMilliseconds", static_cast<int>(elapsed.count()));
+
+    // Assert
+    EXPECT_EQ(count, numProperties);
+    EXPECT_DOUBLE_EQ(sum, 0.5 * numProperties * (numProperties - 1) + 0.25 * numProperties);
+}
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include "Base/Type.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class TypeTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        // The test runner may not have started the application yet
+        if (Base::Type::getNumTypes() == 0) {
+            Base::Type::init();
+        }
+        if (!Base::Type::fromName("TypeTest::Root").isBad()) {
+            return;
+        }
+
+        // Root <- Child <- GrandChild, and Root <- Sibling
+        root = Base::Type::createType(Base::Type::badType(), "TypeTest::Root");
+        child = Base::Type::createType(root, "TypeTest::Child");
+        grandChild = Base::Type::createType(child, "TypeTest::GrandChild");
+        sibling = Base::Type::createType(root, "TypeTest::Sibling");
+
+        // A deep chain of types as found in the App and Part hierarchies
+        Base::Type parent = root;
+        for (int i = 0; i < chainDepth; ++i) {
+            std::string name = "TypeTest::Chain" + std::to_string(i);
+            parent = Base::Type::createType(parent, name.c_str());
+        }
+        leaf = parent;
+    }
+
+    static constexpr int chainDepth = 32;
+    static Base::Type root;
+    static Base::Type child;
+    static Base::Type grandChild;
+    static Base::Type sibling;
+    static Base::Type leaf;
+};
+
+Base::Type TypeTest::root;
+Base::Type TypeTest::child;
+Base::Type TypeTest::grandChild;
+Base::Type TypeTest::sibling;
+Base::Type TypeTest::leaf;
+
+TEST_F(TypeTest, fromName)
+{
+    // Act
+    Base::Type type = Base::Type::fromName("TypeTest::GrandChild");
+
+    // Assert
+    EXPECT_EQ(type, grandChild);
+    EXPECT_STREQ(type.getName(), "TypeTest::GrandChild");
+    EXPECT_EQ(type.getParent(), child);
+}
+
+TEST_F(TypeTest, fromNameUnknown)
+{
+    // Act
+    Base::Type type = Base::Type::fromName("TypeTest::DoesNotExist");
+
+    // Assert
+    EXPECT_TRUE(type.isBad());
+    EXPECT_EQ(type, Base::Type::badType());
+    EXPECT_FALSE(type.isDerivedFrom(root));
+}
+
+TEST_F(TypeTest, fromKey)
+{
+    // Act
+    Base::Type type = Base::Type::fromKey(sibling.getKey());
+
+    // Assert
+    EXPECT_EQ(type, sibling);
+    EXPECT_STREQ(type.getName(), "TypeTest::Sibling");
+}
+
+TEST_F(TypeTest, fromKeyUnknown)
+{
+    // Act
+    Base::Type type = Base::Type::fromKey(static_cast<unsigned int>(Base::Type::getNumTypes()));
+
+    // Assert
+    EXPECT_TRUE(type.isBad());
+}
+
+TEST_F(TypeTest, isDerivedFrom)
+{
+    // Act / Assert
+    EXPECT_TRUE(grandChild.isDerivedFrom(grandChild));
+    EXPECT_TRUE(grandChild.isDerivedFrom(child));
+    EXPECT_TRUE(grandChild.isDerivedFrom(root));
+    EXPECT_TRUE(sibling.isDerivedFrom(root));
+    EXPECT_TRUE(leaf.isDerivedFrom(root));
+    EXPECT_FALSE(root.isDerivedFrom(child));
+    EXPECT_FALSE(child.isDerivedFrom(grandChild));
+    EXPECT_FALSE(sibling.isDerivedFrom(child));
+    EXPECT_FALSE(grandChild.isDerivedFrom(sibling));
+    EXPECT_FALSE(leaf.isDerivedFrom(child));
+    EXPECT_FALSE(root.isDerivedFrom(Base::Type::badType()));
+}
+
+TEST_F(TypeTest, getTypeIfDerivedFrom)
+{
+    // Act / Assert
+    EXPECT_EQ(Base::Type::getTypeIfDerivedFrom("TypeTest::GrandChild", root), grandChild);
+    EXPECT_TRUE(Base::Type::getTypeIfDerivedFrom("TypeTest::Sibling", child).isBad());
+    EXPECT_TRUE(Base::Type::getTypeIfDerivedFrom("TypeTest::DoesNotExist", root).isBad());
+}
+
+TEST_F(TypeTest, getAllDerivedFrom)
+{
+    // Arrange
+    std::vector<Base::Type> types;
+
+    // Act
+    int count = Base::Type::getAllDerivedFrom(child, types);
+
+    // Assert
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(types[0], child);
+    EXPECT_EQ(types[1], grandChild);
+}
+
+TEST_F(TypeTest, isDerivedFromBenchmark)
+{
+    // Arrange
+    const int numLookups = 10000000;
+    Base::Type middle = Base::Type::fromName("TypeTest::Chain15");
+    ASSERT_FALSE(middle.isBad());
+
+    // Act
+    auto start = std::chrono::steady_clock::now();
+    int derived = 0;
+    for (int i = 0; i < numLookups; ++i) {
+        if (leaf.isDerivedFrom(i % 2 == 0 ? middle : sibling)) {
+            ++derived;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    RecordProperty("IsDerivedFromMilliseconds", static_cast<int>(elapsed.count()));
+
+    // Assert
+    EXPECT_EQ(derived, numLookups / 2);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -2,12 +2,19 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <string>
+
 #include <FCConfig.h>
 
+#include <Base/Interpreter.h>
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/Expression.h>
 #include <App/ObjectIdentifier.h>
+#include <App/PropertyLinks.h>
+#include <App/PropertyPythonObject.h>
+#include <App/PropertyStandard.h>
 #include <Mod/Assembly/App/AssemblyObject.h>
 #include <Mod/Assembly/App/JointGroup.h>
 #include <src/App/InitApplication.h>
@@ -18,6 +25,9 @@ protected:
     static void SetUpTestSuite()
     {
         tests::initApplication();
+        Base::Interpreter().runString("class AssemblyTestJointProxy:\n"
+                                      "    def setJointConnectors(self, joint, refs):\n"
+                                      "        pass\n");
     }
 
     void SetUp() override
@@ -40,6 +50,53 @@ protected:
         return _assemblyObj;
     }
 
+    App::DocumentObject* addPart(const char* name)
+    {
+        return _assemblyObj->addObject("App::FeatureTest", name);
+    }
+
+    // A joint as created by the Python joint commands: activated, with both references
+    // relative to the assembly and a proxy implementing setJointConnectors().
+    App::DocumentObject* addJoint(const char* name,
+                                  App::DocumentObject* part1,
+                                  App::DocumentObject* part2)
+    {
+        auto joint = _jointGroupObj->addObject("App::FeaturePython", name);
+        auto activated = static_cast<App::PropertyBool*>(
+            joint->addDynamicProperty("App::PropertyBool", "Activated"));
+        activated->setValue(true);
+        auto ref1 = static_cast<App::PropertyXLinkSub*>(
+            joint->addDynamicProperty("App::PropertyXLinkSub", "Reference1"));
+        ref1->setValue(_assemblyObj, (std::string(part1->getNameInDocument()) + ".").c_str());
+        auto ref2 = static_cast<App::PropertyXLinkSub*>(
+            joint->addDynamicProperty("App::PropertyXLinkSub", "Reference2"));
+        ref2->setValue(_assemblyObj, (std::string(part2->getNameInDocument()) + ".").c_str());
+
+        Base::PyGILStateLocker lock;
+        auto proxy = static_cast<App::PropertyPythonObject*>(joint->getPropertyByName("Proxy"));
+        proxy->setValue(Base::Interpreter().runStringObject("AssemblyTestJointProxy()"));
+        return joint;
+    }
+
+    App::DocumentObject* addGroundedJoint(const char* name, App::DocumentObject* part)
+    {
+        auto joint = _jointGroupObj->addObject("App::FeaturePython", name);
+        auto objToGround = static_cast<App::PropertyLink*>(
+            joint->addDynamicProperty("App::PropertyLink", "ObjectToGround"));
+        objToGround->setValue(part);
+        return joint;
+    }
+
+    static std::vector<App::DocumentObject*>
+    getObjects(const std::vector<Assembly::ObjRef>& refs)
+    {
+        std::vector<App::DocumentObject*> objs;
+        for (const auto& ref : refs) {
+            objs.push_back(ref.obj);
+        }
+        return objs;
+    }
+
 private:
     // TODO: use shared_ptr or something else here?
     Assembly::AssemblyObject* _assemblyObj;
@@ -55,3 +112,96 @@ TEST_F(AssemblyObjectTest, createAssemblyObject)  // NOLINT
 
     // Assert
 }
+
+// Ground - A - B - C is connected to ground, D - E is a floating branch
+TEST_F(AssemblyObjectTest, isPartConnected)  // NOLINT
+{
+    // Arrange
+    auto partA = addPart("PartA");
+    auto partB = addPart("PartB");
+    auto partC = addPart("PartC");
+    auto partD = addPart("PartD");
+    auto partE = addPart("PartE");
+    addGroundedJoint("GroundedJoint", partA);
+    addJoint("JointAB", partA, partB);
+    addJoint("JointBC", partB, partC);
+    addJoint("JointDE", partD, partE);
+
+    // Act & Assert
+    EXPECT_TRUE(getObject()->isPartConnected(partA));
+    EXPECT_TRUE(getObject()->isPartConnected(partB));
+    EXPECT_TRUE(getObject()->isPartConnected(partC));
+    EXPECT_FALSE(getObject()->isPartConnected(partD));
+    EXPECT_FALSE(getObject()->isPartConnected(partE));
+    EXPECT_FALSE(getObject()->isPartConnected(nullptr));
+}
+
+TEST_F(AssemblyObjectTest, isPartConnectedIgnoresDeactivatedJoints)  // NOLINT
+{
+    // Arrange
+    auto partA = addPart("PartA");
+    auto partB = addPart("PartB");
+    auto partC = addPart("PartC");
+    addGroundedJoint("GroundedJoint", partA);
+    addJoint("JointAB", partA, partB);
+    auto jointBC = addJoint("JointBC", partB, partC);
+
+    // Act
+    static_cast<App::PropertyBool*>(jointBC->getPropertyByName("Activated"))->setValue(false);
+
+    // Assert
+    EXPECT_TRUE(getObject()->isPartConnected(partB));
+    EXPECT_FALSE(getObject()->isPartConnected(partC));
+}
+
+TEST_F(AssemblyObjectTest, getDownstreamParts)  // NOLINT
+{
+    // Arrange
+    auto partA = addPart("PartA");
+    auto partB = addPart("PartB");
+    auto partC = addPart("PartC");
+    auto partD = addPart("PartD");
+    auto partE = addPart("PartE");
+    addGroundedJoint("GroundedJoint", partA);
+    auto jointAB = addJoint("JointAB", partA, partB);
+    addJoint("JointBC", partB, partC);
+    addJoint("JointDE", partD, partE);
+
+    // Act
+    auto fromGround = getObjects(getObject()->getDownstreamParts(partA));
+    auto acrossJoint = getObjects(getObject()->getDownstreamParts(partB, jointAB));
+    auto floating = getObjects(getObject()->getDownstreamParts(partD));
+
+    // Assert
+    EXPECT_TRUE(fromGround.empty());
+    EXPECT_EQ(acrossJoint, std::vector<App::DocumentObject*>({partC}));
+    EXPECT_EQ(floating, std::vector<App::DocumentObject*>({partE}));
+    // The joint that was cut is activated again
+    auto activated = static_cast<App::PropertyBool*>(jointAB->getPropertyByName("Activated"));
+    EXPECT_TRUE(activated->getValue());
+    EXPECT_TRUE(getObject()->getDownstreamParts(nullptr).empty());
+}
+
+TEST_F(AssemblyObjectTest, isPartConnectedBenchmark)  // NOLINT
+{
+    // Arrange: a grounded chain of 500 parts
+    const int numParts = 500;
+    std::vector<App::DocumentObject*> parts;
+    for (int i = 0; i < numParts; ++i) {
+        parts.push_back(addPart(("Part" + std::to_string(i)).c_str()));
+    }
+    addGroundedJoint("GroundedJoint", parts.front());
+    for (int i = 1; i < numParts; ++i) {
+        addJoint(("Joint" + std::to_string(i)).c_str(), parts[i - 1], parts[i]);
+    }
+
+    // Act
+    auto start = std::chrono::steady_clock::now();
+    bool connected = getObject()->isPartConnected(parts.back());
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    RecordProperty("ConnectivityMilliseconds", static_cast<int>(elapsed.count()));
+
+    // Assert
+    EXPECT_TRUE(connected);
+}
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <Mod/Material/App/PreCompiled.h>
+#ifndef _PreComp_
+#endif
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QString>
+
+#include <Mod/Material/App/MaterialIndex.h>
+
+// clang-format off
+
+class TestMaterialIndex : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _dirPath = QDir::tempPath() + QString::fromStdString("/TestMaterialIndex");
+        QDir dir(_dirPath);
+        dir.removeRecursively(); // Clear old run data
+        dir.mkpath(_dirPath);
+
+        _cardPath = _dirPath + QString::fromStdString("/Test.FCMat");
+        writeCard("---\n");
+        _indexPath = _dirPath + QString::fromStdString("/MaterialIndex.dat");
+    }
+
+    void TearDown() override {
+        Materials::MaterialIndex::waitForSave();
+        QDir(_dirPath).removeRecursively();
+    }
+
+    void writeCard(const char* data) {
+        QFile card(_cardPath);
+        card.open(QIODevice::Append);
+        card.write(data);
+    }
+
+    Materials::MaterialIndexEntry makeEntry() const {
+        QFileInfo file(_cardPath);
+        Materials::MaterialIndexEntry entry;
+        entry.path = file.canonicalFilePath();
+        entry.modified = file.lastModified().toMSecsSinceEpoch();
+        entry.size = file.size();
+        entry.uuid = QString::fromStdString("c6c64159-19c1-40b5-859c-10561f20f979");
+        entry.physicalModels << QString::fromStdString("9959d007-a970-4ea7-bae4-3eb1b8b883c7");
+        return entry;
+    }
+
+    QString _dirPath;
+    QString _cardPath;
+    QString _indexPath;
+};
+
+TEST_F(TestMaterialIndex, TestRoundTrip)
+{
+    {
+        Materials::MaterialIndex index(_indexPath);
+        EXPECT_EQ(index.find(QFileInfo(_cardPath)), nullptr);
+        index.update(makeEntry());
+        EXPECT_TRUE(index.isModified());
+        index.save();
+        EXPECT_FALSE(index.isModified());
+    }
+
+    Materials::MaterialIndex index(_indexPath);
+    EXPECT_EQ(index.size(), 1U);
+    auto entry = index.find(QFileInfo(_cardPath));
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->uuid, makeEntry().uuid);
+    EXPECT_EQ(entry->physicalModels, makeEntry().physicalModels);
+    EXPECT_TRUE(entry->appearanceModels.isEmpty());
+}
+
+TEST_F(TestMaterialIndex, TestModified)
+{
+    {
+        Materials::MaterialIndex index(_indexPath);
+        index.update(makeEntry());
+        index.save();
+    }
+
+    // A changed card has to be read again
+    writeCard("General:\n");
+    Materials::MaterialIndex index(_indexPath);
+    EXPECT_EQ(index.find(QFileInfo(_cardPath)), nullptr);
+}
+
+TEST_F(TestMaterialIndex, TestRemoved)
+{
+    {
+        Materials::MaterialIndex index(_indexPath);
+        index.update(makeEntry());
+        index.save();
+    }
+
+    // Entries that aren't looked up belong to removed cards
+    {
+        Materials::MaterialIndex index(_indexPath);
+        EXPECT_EQ(index.size(), 1U);
+        index.save();
+    }
+
+    Materials::MaterialIndex index(_indexPath);
+    EXPECT_EQ(index.size(), 0U);
+}
@@ -2,6 +2,7 @@
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
 #include <App/Document.h>
+#include <App/Link.h>
 #include <App/Part.h>
 #include <src/App/InitApplication.h>
 #include <Mod/Mesh/App/Exporter.h>
@@ -147,4 +148,37 @@ TEST_F(ExporterTest, TestMeshesInPart)
     EXPECT_DOUBLE_EQ(bbox.MinZ, -3.0);
     EXPECT_DOUBLE_EQ(bbox.MaxZ, 9.0);
 }
+
+TEST_F(ExporterTest, TestLinksGLTF)
+{
+    Base::Placement plm;
+    plm.setPosition(Base::Vector3d(10, 5, 2));
+    auto link = dynamic_cast<App::Link*>(getDocument()->addObject("App::Link", "Link"));
+    link->LinkedObject.setValue(getMesh2());
+    link->Placement.setValue(plm);
+    getDocument()->recompute();
+
+    Base::FileInfo fi(Base::FileInfo::getTempFileName() + ".glb");
+    // add extra scope because the file will be written when destroying the exporter
+    {
+        Mesh::ExporterGLTF exporter(fi.filePath());
+        exporter.addObject(getMesh2(), 0.1F);
+        exporter.addObject(link, 0.1F);
+    }
+
+    Mesh::MeshObject kernel;
+    EXPECT_TRUE(kernel.load(fi.filePath().c_str()));
+    fi.deleteFile();
+
+    // the positions are quantized to 16 bit
+    const double tolerance = 1e-3;
+    auto bbox = kernel.getBoundBox();
+    EXPECT_EQ(kernel.countFacets(), 24);
+    EXPECT_NEAR(bbox.MinX, -5.0, tolerance);
+    EXPECT_NEAR(bbox.MaxX, 15.0, tolerance);
+    EXPECT_NEAR(bbox.MinY, -5.0, tolerance);
+    EXPECT_NEAR(bbox.MaxY, 10.0, tolerance);
+    EXPECT_NEAR(bbox.MinZ, -5.0, tolerance);
+    EXPECT_NEAR(bbox.MaxZ, 7.0, tolerance);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
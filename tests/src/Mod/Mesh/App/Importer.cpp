@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <Base/FileInfo.h>
 #include <Mod/Mesh/App/Core/IO/Reader3MF.h>
+#include <Mod/Mesh/App/Core/IO/ReaderGLTF.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <sstream>
 #include <xercesc/util/PlatformUtils.hpp>
 #include <zipios++/fcoll.h>
 
@@ -11,6 +14,22 @@ protected:
     {
         XERCES_CPP_NAMESPACE::XMLPlatformUtils::Initialize();
     }
+
+    // A single triangle whose positions are given by the accessor and buffer view
+    static std::string makeGltf(const std::string& accessor, const std::string& bufferView)
+    {
+        // the three corners (0,0,0), (1,0,0) and (0,1,0) as little-endian floats
+        const char* data = "AAAAAAAAAAAAAAAAAACAPwAAAAAAAAAAAAAAAAAAgD8AAAAA";
+        std::ostringstream str;
+        str << R"({"asset": {"version": "2.0"},)"
+            << R"("nodes": [{"mesh": 0}],)"
+            << R"("meshes": [{"primitives": [{"attributes": {"POSITION": 0}}]}],)"
+            << R"("accessors": [)" << accessor << "],"
+            << R"("bufferViews": [)" << bufferView << "],"
+            << R"("buffers": [{"byteLength": 36, "uri": "data:application/octet-stream;base64,)"
+            << data << R"("}]})";
+        return str.str();
+    }
 };
 
 // NOLINTBEGIN(cppcoreguidelines-*,readability-*)
@@ -37,4 +56,40 @@ TEST_F(ImporterTest, Test3MF)
     EXPECT_EQ(mesh2.CountEdges(), 1950);
     EXPECT_EQ(mesh2.CountFacets(), 1300);
 }
+
+TEST_F(ImporterTest, TestGLTF)
+{
+    std::istringstream str(makeGltf(R"({"bufferView": 0, "componentType": 5126, "count": 3})",
+                                    R"({"buffer": 0, "byteLength": 36})"));
+
+    MeshCore::MeshKernel mesh;
+    MeshCore::ReaderGLTF reader(mesh);
+    EXPECT_EQ(reader.Load(str), true);
+    EXPECT_EQ(mesh.CountPoints(), 3);
+    EXPECT_EQ(mesh.CountFacets(), 1);
+}
+
+TEST_F(ImporterTest, TestGLTFMalformedAccessor)
+{
+    // counts and offsets whose products or sums overflow must not pass the bounds check
+    std::vector<std::pair<std::string, std::string>> accessors = {
+        {R"({"bufferView": 0, "componentType": 5126, "count": 4})", R"({"buffer": 0})"},
+        {R"({"bufferView": 0, "componentType": 5126, "count": 1537228672809129302})",
+         R"({"buffer": 0})"},
+        {R"({"bufferView": 0, "componentType": 5126, "count": 2,)"
+         R"( "byteOffset": 18446744073709551600})",
+         R"({"buffer": 0, "byteOffset": 24})"},
+        {R"({"bufferView": 0, "componentType": 5126, "count": 3})",
+         R"({"buffer": 0, "byteStride": 0})"},
+        {R"({"componentType": 5126, "count": 1000000000000})", R"({"buffer": 0})"},
+    };
+
+    for (const auto& [accessor, bufferView] : accessors) {
+        std::istringstream str(makeGltf(accessor, bufferView));
+        MeshCore::MeshKernel mesh;
+        MeshCore::ReaderGLTF reader(mesh);
+        EXPECT_EQ(reader.Load(str), true) << accessor;
+        EXPECT_EQ(mesh.CountFacets(), 0) << accessor;
+    }
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <sstream>
+#include <Base/Exception.h>
 #include <Mod/Mesh/App/Mesh.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 
@@ -95,4 +97,156 @@ TEST(MeshTest, TestGrid2OfAlmostPlanarMesh)
     EXPECT_EQ(countY, 1);
     EXPECT_EQ(countZ, 1);
 }
+
+namespace
+{
+MeshCore::MeshKernel makeQuad()
+{
+    MeshCore::MeshPointArray points;
+    points.emplace_back(0.0F, 0.0F, 0.0F);
+    points.emplace_back(1.0F, 0.0F, 0.0F);
+    points.emplace_back(1.0F, 1.0F, 0.0F);
+    points.emplace_back(0.0F, 1.0F, -2.5F);
+    MeshCore::MeshFacetArray facets;
+    facets.emplace_back(0, 1, 3);
+    facets.emplace_back(3, 1, 2);
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+void expectSameMesh(const MeshCore::MeshKernel& kernel, const MeshCore::MeshKernel& other)
+{
+    ASSERT_EQ(kernel.CountPoints(), other.CountPoints());
+    ASSERT_EQ(kernel.CountFacets(), other.CountFacets());
+    for (unsigned long i = 0; i < kernel.CountPoints(); i++) {
+        EXPECT_EQ(kernel.GetPoint(i), other.GetPoint(i));
+    }
+    const auto& facets = kernel.GetFacets();
+    const auto& otherFacets = other.GetFacets();
+    for (std::size_t i = 0; i < facets.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(facets[i]._aulPoints[j], otherFacets[i]._aulPoints[j]);
+            EXPECT_EQ(facets[i]._aulNeighbours[j], otherFacets[i]._aulNeighbours[j]);
+        }
+    }
+}
+}  // namespace
+
+TEST(MeshTest, TestReadWrite)
+{
+    // Arrange
+    MeshCore::MeshKernel kernel = makeQuad();
+    std::stringstream str;
+
+    // Act
+    kernel.Write(str);
+    MeshCore::MeshKernel restored;
+    bool rebuilt = restored.Read(str);
+
+    // Assert
+    expectSameMesh(kernel, restored);
+    EXPECT_FALSE(rebuilt);
+}
+
+TEST(MeshTest, TestReadWriteCompact)
+{
+    // Arrange
+    MeshCore::MeshKernel kernel = makeQuad();
+    std::stringstream str;
+
+    // Act
+    kernel.WriteCompact(str, false);
+    MeshCore::MeshKernel restored;
+    bool rebuilt = restored.Read(str);
+
+    // Assert
+    expectSameMesh(kernel, restored);
+    EXPECT_TRUE(rebuilt);
+    EXPECT_EQ(restored.GetFacets()[0]._aulNeighbours[1], 1);
+}
+
+TEST(MeshTest, TestReadWriteCompactBytePlanes)
+{
+    // Arrange
+    MeshCore::MeshKernel kernel = makeQuad();
+    std::stringstream str;
+
+    // Act
+    kernel.WriteCompact(str, true);
+    MeshCore::MeshKernel restored;
+    restored.Read(str);
+
+    // Assert
+    expectSameMesh(kernel, restored);
+}
+
+TEST(MeshTest, TestReadCompactWithInvalidIndex)
+{
+    // Arrange
+    MeshCore::MeshKernel kernel = makeQuad();
+    std::stringstream str;
+    kernel.WriteCompact(str);
+    std::string data = str.str();
+    // the index block follows the header and the points, its first byte is the
+    // delta of the first point index
+    std::size_t offset = 5 * sizeof(uint32_t) + 12 * kernel.CountPoints() + sizeof(uint32_t);
+    data[offset] = 0x7e;
+    std::stringstream corrupted(data);
+
+    // Act / Assert
+    MeshCore::MeshKernel restored;
+    EXPECT_THROW(restored.Read(corrupted), Base::BadFormatError);
+}
+
+TEST(MeshTest, TestWriteCompactHeaderIsLittleEndian)
+{
+    // Arrange
+    MeshCore::MeshKernel kernel = makeQuad();
+    std::stringstream str;
+
+    // Act
+    kernel.WriteCompact(str, true);
+    std::string data = str.str();
+
+    // Assert: magic number, version, flags, number of points and facets
+    const unsigned char header[] = {0xD0, 0xC0, 0xB0, 0xA0, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+                                    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00};
+    ASSERT_GT(data.size(), sizeof(header));
+    for (std::size_t i = 0; i < sizeof(header); i++) {
+        EXPECT_EQ(static_cast<unsigned char>(data[i]), header[i]) << "at byte " << i;
+    }
+}
+
+TEST(MeshTest, TestReadCompactWithBigEndianHeader)
+{
+    // Arrange: a stream with the header, the index block size and the bounding
+    // box in big endian order and the point block in little endian order
+    MeshCore::MeshKernel kernel = makeQuad();
+    std::stringstream str;
+    kernel.WriteCompact(str, false);
+    std::string data = str.str();
+    auto swapWord = [&data](std::size_t offset) {
+        std::swap(data[offset], data[offset + 3]);
+        std::swap(data[offset + 1], data[offset + 2]);
+    };
+    for (std::size_t offset = 0; offset < 5 * sizeof(uint32_t); offset += sizeof(uint32_t)) {
+        swapWord(offset);
+    }
+    swapWord(5 * sizeof(uint32_t) + 12 * kernel.CountPoints());
+    for (std::size_t offset = data.size() - 6 * sizeof(float); offset < data.size();
+         offset += sizeof(float)) {
+        swapWord(offset);
+    }
+    std::stringstream swapped(data);
+
+    // Act
+    MeshCore::MeshKernel restored;
+    restored.Read(swapped);
+
+    // Assert
+    expectSameMesh(kernel, restored);
+    EXPECT_EQ(restored.GetBoundBox().MinZ, -2.5F);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
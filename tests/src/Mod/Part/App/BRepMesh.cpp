@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include "Mod/Part/App/BRepMesh.h"
 
 // NOLINTBEGIN
@@ -128,6 +129,44 @@ protected:
         domains.push_back(domain2);
         return domains;
     }
+
+    // Two square grids of size x size points sharing the edge on the x axis.
+    // The shared points of the second grid are moved within the tolerance.
+    std::vector<Part::BRepMesh::Domain> getGridDomains(int size) const
+    {
+        double eps = 1.0e-10;
+        Part::BRepMesh::Domain domain1;
+        Part::BRepMesh::Domain domain2;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                domain1.points.emplace_back(i, j, 0);
+                domain2.points.emplace_back(i, j == 0 ? eps : 0, j == 0 ? eps : j);
+            }
+        }
+
+        for (int i = 0; i < size - 1; i++) {
+            for (int j = 0; j < size - 1; j++) {
+                uint32_t index = i * size + j;
+                Part::BRepMesh::Facet f1;
+                f1.I1 = index;
+                f1.I2 = index + size;
+                f1.I3 = index + size + 1;
+                Part::BRepMesh::Facet f2;
+                f2.I1 = index;
+                f2.I2 = index + size + 1;
+                f2.I3 = index + 1;
+                domain1.facets.emplace_back(f1);
+                domain1.facets.emplace_back(f2);
+                domain2.facets.emplace_back(f1);
+                domain2.facets.emplace_back(f2);
+            }
+        }
+
+        std::vector<Part::BRepMesh::Domain> domains;
+        domains.push_back(domain1);
+        domains.push_back(domain2);
+        return domains;
+    }
 };
 
 TEST_F(BRepMeshTest, testNoDomains)
@@ -173,4 +212,31 @@ TEST_F(BRepMeshTest, testUnconnectedDomains)
     EXPECT_EQ(points.size(), 6);
     EXPECT_EQ(faces.size(), 4);
 }
+
+TEST_F(BRepMeshTest, testLargeDomains)
+{
+    // more points than fit into a single chunk of the parallel sort
+    const int size = 200;
+    std::vector<Base::Vector3d> points;
+    std::vector<Part::BRepMesh::Facet> faces;
+    Part::BRepMesh brepMesh;
+    brepMesh.getFacesFromDomains(getGridDomains(size), points, faces);
+
+    EXPECT_EQ(points.size(), 2 * size * size - size);
+    EXPECT_EQ(faces.size(), 4 * (size - 1) * (size - 1));
+
+    std::vector<bool> used(points.size());
+    for (const auto& face : faces) {
+        ASSERT_LT(face.I1, points.size());
+        ASSERT_LT(face.I2, points.size());
+        ASSERT_LT(face.I3, points.size());
+        used[face.I1] = used[face.I2] = used[face.I3] = true;
+    }
+    EXPECT_EQ(std::count(used.begin(), used.end(), false), 0);
+
+    auto segments = brepMesh.createSegments();
+    ASSERT_EQ(segments.size(), 2);
+    EXPECT_EQ(segments[0].size(), 2 * (size - 1) * (size - 1));
+    EXPECT_EQ(segments[1].size(), 2 * (size - 1) * (size - 1));
+}
 // NOLINTEND
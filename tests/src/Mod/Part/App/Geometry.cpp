@@ -4,6 +4,11 @@
 
 #include <boost/core/ignore_unused.hpp>
 #include "Mod/Part/App/Geometry.h"
+#include "Mod/Part/App/PropertyGeometryList.h"
+#include <Base/Exception.h>
+#include <Base/Reader.h>
+#include <Base/Stream.h>
+#include <Base/Writer.h>
 #include <src/App/InitApplication.h>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include "PartTestHelpers.h"
@@ -90,3 +95,87 @@ TEST_F(GeometryTest, testTrimBSpline)
     EXPECT_DOUBLE_EQ(nonPeriodicBSpline1.getFirstParameter(), param1);
     EXPECT_DOUBLE_EQ(nonPeriodicBSpline1.getLastParameter(), param2);
 }
+
+TEST_F(GeometryTest, testBinaryGeometryListRoundTrip)
+{
+    // Arrange
+    auto line = new Part::GeomLineSegment();
+    line->setPoints(Base::Vector3d(1.0, 2.0, 0.0), Base::Vector3d(3.0, 4.0, 0.0));
+    auto arc = new Part::GeomArcOfCircle();
+    arc->setCenter(Base::Vector3d(1.0, 2.0, 0.0));
+    arc->setRadius(3.0);
+    arc->setRange(M_PI / 3, M_PI * 1.5, true);
+    auto ellipse = new Part::GeomEllipse();
+    ellipse->setCenter(Base::Vector3d(-1.0, 0.5, 0.0));
+    ellipse->setMajorRadius(4.0);
+    ellipse->setMinorRadius(3.0);
+    std::vector<Base::Vector3d> poles {{1, 0, 0}, {1, 1, 0}, {1, 0.5, 0}, {0, 1, 0}, {0, 0, 0}};
+    auto bspline = new Part::GeomBSplineCurve(poles,
+                                              std::vector<double>(5, 1.0),
+                                              {0.0, 1.0, 2.0},
+                                              {4, 1, 4},
+                                              3,
+                                              false);
+    Part::PropertyGeometryList prop;
+    prop.setValues(std::vector<Part::Geometry*> {line, arc, ellipse, bspline});
+    for (auto geom : prop.getValues()) {
+        ASSERT_TRUE(geom->canSaveBinary());
+    }
+
+    // Act
+    Base::StringWriter writer;
+    prop.SaveDocFile(writer);
+    std::istringstream stream(writer.getString());
+    Base::Reader reader(stream, "Geometry", 0);
+    Part::PropertyGeometryList restored;
+    restored.RestoreDocFile(reader);
+
+    // Assert
+    ASSERT_EQ(restored.getSize(), prop.getSize());
+    for (int i = 0; i < prop.getSize(); i++) {
+        auto original = dynamic_cast<const Part::GeomCurve*>(prop[i]);
+        auto copy = dynamic_cast<const Part::GeomCurve*>(restored[i]);
+        ASSERT_TRUE(original && copy);
+        EXPECT_EQ(copy->getTypeId(), original->getTypeId());
+        EXPECT_DOUBLE_EQ(copy->getFirstParameter(), original->getFirstParameter());
+        EXPECT_DOUBLE_EQ(copy->getLastParameter(), original->getLastParameter());
+        for (double param : {0.0, 0.3, 0.7, 1.0}) {
+            double u = original->getFirstParameter()
+                + (original->getLastParameter() - original->getFirstParameter()) * param;
+            EXPECT_TRUE(copy->pointAtParameter(u).IsEqual(original->pointAtParameter(u), 1e-12));
+        }
+    }
+}
+
+TEST_F(GeometryTest, testBinaryStringWithCorruptLength)
+{
+    // Arrange: a length of almost 4 GiB followed by a few bytes only
+    std::ostringstream data;
+    Base::OutputStream out(data);
+    out << static_cast<uint32_t>(0xFFFFFFF0);
+    out.write("Line", 4);
+    std::istringstream stream(data.str());
+    Base::InputStream in(stream);
+
+    // Act & Assert
+    EXPECT_THROW(Part::GeometryPersistenceExtension::readString(in), Base::RestoreError);
+}
+
+TEST_F(GeometryTest, testBinaryGeometryListWithCorruptLength)
+{
+    // Arrange: version 1, two geometries, but the first type name has a corrupt length
+    std::ostringstream data;
+    Base::OutputStream out(data);
+    out << static_cast<uint32_t>(1) << static_cast<uint32_t>(2)
+        << static_cast<uint32_t>(0xFFFFFFF0);
+    out.write("Part::GeomLineSegment", 21);
+    std::istringstream stream(data.str());
+    Base::Reader reader(stream, "Geometry", 0);
+    Part::PropertyGeometryList restored;
+
+    // Act
+    restored.RestoreDocFile(reader);
+
+    // Assert
+    EXPECT_EQ(restored.getSize(), 0);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsGrid.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsGridTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < 10; i++) {
+            for (int j = 0; j < 10; j++) {
+                points.emplace_back(float(i), float(j), 0.0F);
+            }
+        }
+        kernel.setBasicPoints(points);
+    }
+
+    const Points::PointKernel& getKernel() const
+    {
+        return kernel;
+    }
+
+private:
+    Points::PointKernel kernel;
+};
+
+TEST_F(PointsGridTest, TestVerify)
+{
+    Points::PointsGrid grid(getKernel(), 4);
+    EXPECT_TRUE(grid.Verify());
+}
+
+TEST_F(PointsGridTest, TestInSide)
+{
+    // Arrange
+    Points::PointsGrid grid(getKernel(), 4);
+    std::vector<unsigned long> elements;
+
+    // Act
+    grid.InSide(Base::BoundBox3d(-0.5, -0.5, -0.5, 9.5, 9.5, 0.5), elements);
+
+    // Assert
+    EXPECT_EQ(elements.size(), 100);
+}
+
+TEST_F(PointsGridTest, TestSearchNearest)
+{
+    // Arrange
+    Points::PointsGrid grid(getKernel(), 4);
+    std::vector<Base::Vector3d> pts;
+    pts.emplace_back(0.1, 0.0, 0.0);
+    pts.emplace_back(5.0, 4.9, 1.0);
+    std::vector<unsigned long> neighbours;
+
+    // Act
+    grid.SearchNearest(pts, 2, neighbours);
+
+    // Assert
+    ASSERT_EQ(neighbours.size(), 4);
+    EXPECT_EQ(neighbours[0], 0);
+    EXPECT_EQ(neighbours[1], 10);
+    EXPECT_EQ(neighbours[2], 55);
+    EXPECT_EQ(neighbours[3], 54);
+}
+
+TEST_F(PointsGridTest, TestSearchNearestWithTooFewPoints)
+{
+    // Arrange
+    Points::PointKernel kernel;
+    std::vector<Base::Vector3f> points;
+    points.emplace_back(0.0F, 0.0F, 0.0F);
+    points.emplace_back(1.0F, 1.0F, 1.0F);
+    kernel.setBasicPoints(points);
+    Points::PointsGrid grid(kernel, 4);
+    std::vector<unsigned long> neighbours;
+
+    // Act
+    grid.SearchNearest({Base::Vector3d(2.0, 2.0, 2.0)}, 3, neighbours);
+
+    // Assert
+    ASSERT_EQ(neighbours.size(), 3);
+    EXPECT_EQ(neighbours[0], 1);
+    EXPECT_EQ(neighbours[1], 0);
+    EXPECT_EQ(neighbours[2], ULONG_MAX);
+}
+
+TEST_F(PointsGridTest, TestSearchRadius)
+{
+    // Arrange
+    Points::PointsGrid grid(getKernel(), 4);
+    std::vector<Base::Vector3d> pts;
+    pts.emplace_back(0.0, 0.0, 0.0);
+    pts.emplace_back(5.0, 5.0, 0.0);
+    pts.emplace_back(20.0, 20.0, 0.0);
+    std::vector<unsigned long> offsets;
+    std::vector<unsigned long> neighbours;
+
+    // Act
+    grid.SearchRadius(pts, 1.0, offsets, neighbours);
+
+    // Assert
+    ASSERT_EQ(offsets.size(), 4);
+    EXPECT_EQ(offsets[0], 0);
+    EXPECT_EQ(offsets[1], 3);
+    EXPECT_EQ(offsets[2], 8);
+    EXPECT_EQ(offsets[3], 8);
+    std::vector<unsigned long> first(neighbours.begin(), neighbours.begin() + 3);
+    std::vector<unsigned long> second(neighbours.begin() + 3, neighbours.end());
+    EXPECT_EQ(first, std::vector<unsigned long>({0, 1, 10}));
+    EXPECT_EQ(second, std::vector<unsigned long>({45, 54, 55, 56, 65}));
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
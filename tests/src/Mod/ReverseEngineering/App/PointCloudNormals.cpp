@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include <Base/Exception.h>
+#include <Mod/Points/App/Points.h>
+#include <Mod/ReverseEngineering/App/PointCloudNormals.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointCloudNormalsTest: public ::testing::Test
+{
+protected:
+    // Evenly distributed points on a sphere (Fibonacci lattice)
+    void makeSphere(int count)
+    {
+        const double golden = M_PI * (3.0 - std::sqrt(5.0));
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < count; i++) {
+            double z = 1.0 - 2.0 * (i + 0.5) / count;
+            double r = std::sqrt(1.0 - z * z);
+            double phi = golden * i;
+            Base::Vector3d dir(r * std::cos(phi), r * std::sin(phi), z);
+            Base::Vector3d pnt = center + radius * dir;
+            points.emplace_back(float(pnt.x), float(pnt.y), float(pnt.z));
+        }
+        kernel.setBasicPoints(points);
+    }
+
+    Base::Vector3d radial(std::size_t index) const
+    {
+        Base::Vector3d dir = kernel.getPoint(int(index)) - center;
+        return dir.Normalize();
+    }
+
+    Points::PointKernel kernel;
+    const Base::Vector3d center {1.0, 2.0, -1.0};
+    const double radius {5.0};
+};
+
+TEST_F(PointCloudNormalsTest, planeNormals)
+{
+    // Arrange -- the plane z = 0.5 * x + 0.25 * y + 3
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 30; j++) {
+            float x = 0.1F * float(i);
+            float y = 0.1F * float(j);
+            points.emplace_back(x, y, 0.5F * x + 0.25F * y + 3.0F);
+        }
+    }
+    kernel.setBasicPoints(points);
+    Reen::PointCloudNormals estimation(kernel);
+    estimation.setKSearch(8);
+    estimation.setViewPoint(Base::Vector3d(0.0, 0.0, 100.0));
+    Base::Vector3d expected(-0.5, -0.25, 1.0);
+    expected.Normalize();
+
+    // Act
+    std::vector<Base::Vector3d> normals;
+    estimation.perform(normals);
+
+    // Assert
+    ASSERT_EQ(normals.size(), points.size());
+    for (const auto& normal : normals) {
+        EXPECT_NEAR(normal * expected, 1.0, 1e-4);
+    }
+}
+
+TEST_F(PointCloudNormalsTest, sphereNormalsTowardsViewPoint)
+{
+    // Arrange
+    makeSphere(2000);
+    Reen::PointCloudNormals estimation(kernel);
+    estimation.setKSearch(10);
+    estimation.setViewPoint(center);
+
+    // Act
+    std::vector<Base::Vector3d> normals;
+    estimation.perform(normals);
+
+    // Assert -- all normals point inwards
+    ASSERT_EQ(normals.size(), kernel.size());
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        EXPECT_LT(normals[i] * radial(i), -0.99);
+    }
+}
+
+TEST_F(PointCloudNormalsTest, searchRadius)
+{
+    // Arrange
+    makeSphere(2000);
+    Reen::PointCloudNormals estimation(kernel);
+    estimation.setSearchRadius(1.0);
+    estimation.setViewPoint(center);
+
+    // Act
+    std::vector<Base::Vector3d> normals;
+    estimation.perform(normals);
+
+    // Assert
+    ASSERT_EQ(normals.size(), kernel.size());
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        EXPECT_LT(normals[i] * radial(i), -0.99);
+    }
+}
+
+TEST_F(PointCloudNormalsTest, missingNeighbourSettings)
+{
+    // Arrange
+    makeSphere(100);
+    Reen::PointCloudNormals estimation(kernel);
+
+    // Act
+    std::vector<Base::Vector3d> normals;
+
+    // Assert
+    EXPECT_THROW(estimation.perform(normals), Base::ValueError);
+}
+
+TEST_F(PointCloudNormalsTest, orientConsistently)
+{
+    // Arrange -- exact normals with every other one flipped
+    makeSphere(2000);
+    std::vector<Base::Vector3d> normals;
+    for (std::size_t i = 0; i < kernel.size(); i++) {
+        normals.push_back(i % 2 == 0 ? radial(i) : -radial(i));
+    }
+
+    // Act
+    Reen::PointCloudNormals::orient(kernel, normals, 10);
+
+    // Assert -- the highest normal points upwards, so all point outwards
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        EXPECT_GT(normals[i] * radial(i), 0.99);
+    }
+}
+
+TEST_F(PointCloudNormalsTest, orientEstimatedNormals)
+{
+    // Arrange
+    makeSphere(2000);
+    Reen::PointCloudNormals estimation(kernel);
+    estimation.setKSearch(10);
+    estimation.setViewPoint(center);
+    std::vector<Base::Vector3d> normals;
+    estimation.perform(normals);
+
+    // Act
+    Reen::PointCloudNormals::orient(kernel, normals, 10);
+
+    // Assert
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        EXPECT_GT(normals[i] * radial(i), 0.99);
+    }
+}
+
+TEST_F(PointCloudNormalsTest, orientWithWrongNumberOfNormals)
+{
+    // Arrange
+    makeSphere(100);
+    std::vector<Base::Vector3d> normals(10);
+
+    // Act & Assert
+    EXPECT_THROW(Reen::PointCloudNormals::orient(kernel, normals, 10), Base::ValueError);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include <Base/Exception.h>
+#include <Mod/ReverseEngineering/App/PointCloudRansac.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+// A regular grid on the plane z = 2 and a few points off the plane
+void makePlane(std::vector<Base::Vector3d>& points, int& onPlane)
+{
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            points.emplace_back(0.1 * i, 0.1 * j, 2.0);
+        }
+    }
+    onPlane = int(points.size());
+    points.emplace_back(0.5, 0.5, 3.0);
+    points.emplace_back(1.0, 0.2, 0.5);
+    points.emplace_back(0.3, 1.5, -1.0);
+}
+}  // namespace
+
+TEST(PointCloudRansac, fitPlane)
+{
+    // Arrange
+    std::vector<Base::Vector3d> points;
+    std::vector<Base::Vector3d> normals;
+    int onPlane {};
+    makePlane(points, onPlane);
+    Reen::PointCloudRansac ransac(Reen::PointCloudRansac::Plane, points, normals);
+    ransac.setDistanceThreshold(0.01);
+
+    // Act
+    std::vector<double> parameters;
+    std::vector<int> inliers;
+    bool found = ransac.perform(parameters, inliers);
+
+    // Assert
+    ASSERT_TRUE(found);
+    ASSERT_EQ(parameters.size(), 4);
+    EXPECT_NEAR(parameters[0], 0.0, 1e-9);
+    EXPECT_NEAR(parameters[1], 0.0, 1e-9);
+    EXPECT_NEAR(std::fabs(parameters[2]), 1.0, 1e-9);
+    EXPECT_NEAR(parameters[2] * 2.0 + parameters[3], 0.0, 1e-9);
+    EXPECT_EQ(inliers.size(), onPlane);
+}
+
+TEST(PointCloudRansac, fitSphere)
+{
+    // Arrange
+    const Base::Vector3d center(1.0, -2.0, 0.5);
+    const double radius = 3.0;
+    std::vector<Base::Vector3d> points;
+    std::vector<Base::Vector3d> normals;
+    for (int i = 1; i < 10; i++) {
+        double theta = M_PI * i / 10.0;
+        for (int j = 0; j < 20; j++) {
+            double phi = 2.0 * M_PI * j / 20.0;
+            Base::Vector3d dir(std::sin(theta) * std::cos(phi),
+                               std::sin(theta) * std::sin(phi),
+                               std::cos(theta));
+            points.push_back(center + radius * dir);
+        }
+    }
+    Reen::PointCloudRansac ransac(Reen::PointCloudRansac::Sphere, points, normals);
+    ransac.setDistanceThreshold(0.01);
+
+    // Act
+    std::vector<double> parameters;
+    std::vector<int> inliers;
+    bool found = ransac.perform(parameters, inliers);
+
+    // Assert
+    ASSERT_TRUE(found);
+    ASSERT_EQ(parameters.size(), 4);
+    EXPECT_NEAR(parameters[0], center.x, 1e-6);
+    EXPECT_NEAR(parameters[1], center.y, 1e-6);
+    EXPECT_NEAR(parameters[2], center.z, 1e-6);
+    EXPECT_NEAR(parameters[3], radius, 1e-6);
+    EXPECT_EQ(inliers.size(), points.size());
+}
+
+TEST(PointCloudRansac, fitCylinder)
+{
+    // Arrange
+    const double radius = 1.5;
+    std::vector<Base::Vector3d> points;
+    std::vector<Base::Vector3d> normals;
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 24; j++) {
+            double phi = 2.0 * M_PI * j / 24.0;
+            Base::Vector3d normal(std::cos(phi), std::sin(phi), 0.0);
+            points.emplace_back(radius * normal.x, radius * normal.y, 0.2 * i);
+            normals.push_back(normal);
+        }
+    }
+    Reen::PointCloudRansac ransac(Reen::PointCloudRansac::Cylinder, points, normals);
+    ransac.setDistanceThreshold(0.01);
+
+    // Act
+    std::vector<double> parameters;
+    std::vector<int> inliers;
+    bool found = ransac.perform(parameters, inliers);
+
+    // Assert
+    ASSERT_TRUE(found);
+    ASSERT_EQ(parameters.size(), 7);
+    Base::Vector3d base(parameters[0], parameters[1], parameters[2]);
+    Base::Vector3d axis(parameters[3], parameters[4], parameters[5]);
+    EXPECT_NEAR(std::fabs(axis.z), 1.0, 1e-6);
+    EXPECT_NEAR(base.DistanceToLine(Base::Vector3d(), Base::Vector3d(0.0, 0.0, 1.0)), 0.0, 1e-6);
+    EXPECT_NEAR(parameters[6], radius, 1e-6);
+    EXPECT_EQ(inliers.size(), points.size());
+}
+
+TEST(PointCloudRansac, cylinderRequiresNormals)
+{
+    // Arrange
+    std::vector<Base::Vector3d> points;
+    std::vector<Base::Vector3d> normals;
+    int onPlane {};
+    makePlane(points, onPlane);
+    Reen::PointCloudRansac ransac(Reen::PointCloudRansac::Cylinder, points, normals);
+
+    // Act
+    std::vector<double> parameters;
+    std::vector<int> inliers;
+
+    // Assert
+    EXPECT_THROW(ransac.perform(parameters, inliers), Base::ValueError);
+}
+
+TEST(PointCloudRansac, duplicateIndices)
+{
+    // Arrange -- enough indices for a sample, but too few distinct ones
+    std::vector<Base::Vector3d> points;
+    std::vector<Base::Vector3d> normals;
+    int onPlane {};
+    makePlane(points, onPlane);
+    Reen::PointCloudRansac ransac(Reen::PointCloudRansac::Plane, points, normals);
+    ransac.setIndices({0, 1, 0, 1, 0});
+
+    // Act
+    std::vector<double> parameters;
+    std::vector<int> inliers;
+    bool found = ransac.perform(parameters, inliers);
+
+    // Assert
+    EXPECT_FALSE(found);
+    EXPECT_TRUE(parameters.empty());
+    EXPECT_TRUE(inliers.empty());
+}
+
+TEST(PointCloudRansac, subsetOfIndices)
+{
+    // Arrange
+    std::vector<Base::Vector3d> points;
+    std::vector<Base::Vector3d> normals;
+    int onPlane {};
+    makePlane(points, onPlane);
+    Reen::PointCloudRansac ransac(Reen::PointCloudRansac::Plane, points, normals);
+    ransac.setIndices({0, 1, 20, 21, 21, 42});
+
+    // Act
+    std::vector<double> parameters;
+    std::vector<int> inliers;
+    bool found = ransac.perform(parameters, inliers);
+
+    // Assert
+    ASSERT_TRUE(found);
+    EXPECT_EQ(inliers, std::vector<int>({0, 1, 20, 21, 42}));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
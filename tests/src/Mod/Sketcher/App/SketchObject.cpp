@@ -8,6 +8,7 @@
 #include <App/Document.h>
 #include <App/Expression.h>
 #include <App/ObjectIdentifier.h>
+#include <Base/FileInfo.h>
 #include <Mod/Sketcher/App/GeoEnum.h>
 #include <Mod/Sketcher/App/SketchObject.h>
 #include <src/App/InitApplication.h>
@@ -1275,3 +1276,127 @@ TEST_F(SketchObjectTest, testGetElementName)
     EXPECT_STREQ(reverse_export_name.newName.c_str(), (";" + tagName + "v1;SKT.Vertex1").c_str());
     EXPECT_STREQ(reverse_export_name.oldName.c_str(), "Vertex1");
 }
+
+TEST_F(SketchObjectTest, testSetDatumSolvesWithUpdatedValue)
+{
+    // Arrange
+    Part::GeomLineSegment lineSeg;
+    setupLineSegment(lineSeg);
+    int geoId = getObject()->addGeometry(&lineSeg);
+    auto constraint = std::make_unique<Sketcher::Constraint>();
+    constraint->Type = Sketcher::ConstraintType::Distance;
+    constraint->First = geoId;
+    constraint->setValue(5.0);
+    int constrId = getObject()->addConstraint(std::move(constraint));
+    getObject()->solve();
+    auto getLength = [this, geoId]() {
+        auto line = static_cast<const Part::GeomLineSegment*>(getObject()->getGeometry(geoId));
+        return (line->getEndPoint() - line->getStartPoint()).Length();
+    };
+
+    auto getSetUpCount = [this]() {
+        return getObject()->getSolvedSketch().getFullSetUpCount();
+    };
+    int setUpCount = getSetUpCount();
+    ASSERT_GT(setUpCount, 0);
+
+    // Act & Assert: successive datum changes only update the values in the solver
+    for (double length : {6.0, 7.5, 2.0}) {
+        EXPECT_EQ(getObject()->setDatum(constrId, length), 0);
+        EXPECT_NEAR(getLength(), length, 1e-7);
+    }
+    EXPECT_EQ(getSetUpCount(), setUpCount);
+
+    // Act & Assert: solving again with unchanged geometry keeps the solver system
+    EXPECT_EQ(getObject()->solve(), 0);
+    EXPECT_NEAR(getLength(), 2.0, 1e-7);
+    EXPECT_EQ(getSetUpCount(), setUpCount);
+
+    // Act & Assert: a structural change still triggers a full set up
+    auto horizontal = std::make_unique<Sketcher::Constraint>();
+    horizontal->Type = Sketcher::ConstraintType::Horizontal;
+    horizontal->First = geoId;
+    getObject()->addConstraint(std::move(horizontal));
+    EXPECT_EQ(getObject()->setDatum(constrId, 3.0), 0);
+    EXPECT_NEAR(getLength(), 3.0, 1e-7);
+    auto line = static_cast<const Part::GeomLineSegment*>(getObject()->getGeometry(geoId));
+    EXPECT_NEAR(line->getStartPoint().y, line->getEndPoint().y, 1e-7);
+    EXPECT_GT(getSetUpCount(), setUpCount);
+
+    // Act & Assert: the rebuilt system is reused again for the next datum change
+    setUpCount = getSetUpCount();
+    EXPECT_EQ(getObject()->setDatum(constrId, 4.0), 0);
+    EXPECT_NEAR(getLength(), 4.0, 1e-7);
+    EXPECT_EQ(getSetUpCount(), setUpCount);
+}
+
+TEST_F(SketchObjectTest, testBinaryGeometryRoundTrip)
+{
+    // Arrange: a sketch constrained to an external edge of another sketch
+    App::Document* doc = getObject()->getDocument();
+    auto source = static_cast<Sketcher::SketchObject*>(doc->addObject("Sketcher::SketchObject"));
+    Part::GeomLineSegment sourceLine;
+    setupLineSegment(sourceLine);
+    source->addGeometry(&sourceLine);
+    doc->recompute();
+
+    Part::GeomCircle circle;
+    setupCircle(circle);
+    int circleId = getObject()->addGeometry(&circle);
+    Part::GeomArcOfCircle arc;
+    setupArcOfCircle(arc);
+    getObject()->addGeometry(&arc, true);
+    EXPECT_GE(getObject()->addExternal(source, "Edge1"), 0);
+    auto coincident = std::make_unique<Sketcher::Constraint>();
+    coincident->Type = Sketcher::ConstraintType::Coincident;
+    coincident->First = circleId;
+    coincident->FirstPos = Sketcher::PointPos::mid;
+    coincident->Second = Sketcher::GeoEnum::RefExt;
+    coincident->SecondPos = Sketcher::PointPos::start;
+    getObject()->addConstraint(std::move(coincident));
+    auto radius = std::make_unique<Sketcher::Constraint>();
+    radius->Type = Sketcher::ConstraintType::Radius;
+    radius->First = circleId;
+    radius->setValue(2.5);
+    getObject()->addConstraint(std::move(radius));
+    doc->recompute();
+
+    std::string sketchName = getObject()->getNameInDocument();
+    int geometryCount = getObject()->Geometry.getSize();
+    int externalCount = getObject()->getExternalGeometryCount();
+    int constraintCount = getObject()->Constraints.getSize();
+    ASSERT_GT(externalCount, 2);  // the axes and the external edge
+
+    // Act: save with binary geometry and open it again
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    bool binaryGeometry = hGrp->GetBool("SaveBinaryGeometry", false);
+    hGrp->SetBool("SaveBinaryGeometry", true);
+    std::string fileName = Base::FileInfo::getTempFileName() + ".FCStd";
+    bool saved = doc->saveCopy(fileName.c_str());
+    hGrp->SetBool("SaveBinaryGeometry", binaryGeometry);
+    ASSERT_TRUE(saved);
+
+    App::Document* restoredDoc = App::GetApplication().openDocument(fileName.c_str(), false);
+    ASSERT_TRUE(restoredDoc);
+    auto restored =
+        dynamic_cast<Sketcher::SketchObject*>(restoredDoc->getObject(sketchName.c_str()));
+
+    // Assert: the constraints on the external edge survived the restore, which they don't if
+    // they are checked before the external geometry is restored
+    ASSERT_TRUE(restored);
+    EXPECT_EQ(restored->Geometry.getSize(), geometryCount);
+    EXPECT_EQ(restored->getExternalGeometryCount(), externalCount);
+    EXPECT_EQ(restored->Constraints.getSize(), constraintCount);
+    EXPECT_EQ(restored->Constraints.getValues().size(), static_cast<size_t>(constraintCount));
+    EXPECT_EQ(restored->Constraints[0]->Second, Sketcher::GeoEnum::RefExt);
+    EXPECT_DOUBLE_EQ(restored->Constraints[1]->getValue(), 2.5);
+    auto restoredCircle = dynamic_cast<const Part::GeomCircle*>(restored->getGeometry(circleId));
+    ASSERT_TRUE(restoredCircle);
+    EXPECT_NEAR(restoredCircle->getRadius(), 2.5, 1e-7);
+    EXPECT_TRUE(restoredCircle->getCenter().IsEqual(sourceLine.getStartPoint(), 1e-7));
+    EXPECT_TRUE(restored->getGeometryFacade(circleId + 1)->getConstruction());
+
+    App::GetApplication().closeDocument(restoredDoc->getName());
+    Base::FileInfo(fileName).deleteFile();
+}